@@ -31,6 +31,7 @@
 #include <OFILE.h>
 #include <GAMEDEF.h>
 #include <OERROR.h>
+#include <OMEMSTAT.h>
 
 
 //-------- Define macro functions -------//
@@ -75,12 +76,12 @@ extern Mem mem;
 
 #else
 
-	#include <stdlib.h>
+	// accounted by source file, see MemStat
 
-	#define mem_add(memSize)            ((char*)malloc(memSize))
-	#define mem_add_clear(memSize)      ((char*)calloc(1,memSize))
-	#define mem_resize(orgPtr, newSize) ((char*)realloc(orgPtr,newSize))
-	#define mem_del(memPtr)             free(memPtr)
+	#define mem_add(memSize)            MemStat::add(memSize, MEM_ACCOUNT_ID())
+	#define mem_add_clear(memSize)      MemStat::add_clear(memSize, MEM_ACCOUNT_ID())
+	#define mem_resize(orgPtr, newSize) MemStat::resize(orgPtr, newSize, MEM_ACCOUNT_ID())
+	#define mem_del(memPtr)             MemStat::del(memPtr)
 
 #endif
 
@@ -30,6 +30,8 @@ enum StartupMode
 	STARTUP_MULTI_PLAYER,
 	STARTUP_TEST,
 	STARTUP_DEMO,
+	STARTUP_REPLAY,
+	STARTUP_SAVE_CHECK,
 };
 
 struct CmdLine
@@ -40,6 +42,11 @@ struct CmdLine
 	int		rnd;
 	StartupMode	startup_mode;
 	char		*join_host;
+	char		*replay_path;
+	char		*replay_crc_path;
+	char		*replay_report_path;
+	int		max_slowdown;
+	char		*save_check_path;
 
 	CmdLine();
 	~CmdLine();
@@ -45,7 +45,7 @@ public:
 	#endif
 
 	void	run_loaded();
-	void	run_replay();
+	int	run_replay(const char* replayPath=NULL);
 	void	run_test();
 
 private:
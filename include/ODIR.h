@@ -26,6 +26,8 @@
 
 #include <ODYNARR.h>
 
+#include <stdint.h>
+
 struct TimeInfo
 {
    int year;
@@ -43,6 +45,7 @@ struct FileInfo
     char          name[FilePath::MAX_FILE_PATH];
     unsigned long size;
     TimeInfo      time;
+    int64_t       mod_time;    // last modification time, only for telling whether a file has changed
 };
 
 //---------- Define class Directory ----------//
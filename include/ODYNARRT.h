@@ -0,0 +1,330 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    :: ODYNARRT.H
+//Description :: Typed Dynamic Array Template
+//
+// DynArrayT<T> is the typed successor of DynArray. Records are still
+// numbered from 1 and write_file()/read_file() use the same file layout
+// as DynArray, so an array can be moved over from DynArray without
+// changing the saved games. Unlike DynArray it has no current position,
+// grows geometrically and sorts with inlined comparators.
+//
+// Migrating an array:
+//
+//   DynArray a(sizeof(Foo), 50);      ->  DynArrayT<Foo> a(50);
+//   (Foo*) a.get(i)                   ->  a.get(i)
+//   a.linkin(&foo)                    ->  a.linkin(&foo)
+//   a.quick_sort(cmp_func)            ->  a.stable_sort(cmp_less)
+//
+// Element addresses change when the array grows, as with DynArray. Call
+// reserve() beforehand, or keep pointers in the array, where they must
+// not move.
+
+#ifndef __ODYNARRT_H
+#define __ODYNARRT_H
+
+#ifndef __ODYNARR_H
+#include <ODYNARR.h>
+#endif
+
+#ifndef __OFILE_H
+#include <OFILE.h>
+#endif
+
+#include <algorithm>
+#include <type_traits>
+
+//------ Define struct DynArrayFileHeader ------//
+//
+// The record DynArray::write_file() writes in front of the elements.
+//
+struct DynArrayFileHeader
+{
+	int  ele_num;
+	int  block_num;
+	int  cur_pos;
+	int  last_ele;
+	int  ele_size;
+	int  sort_offset;
+	char sort_type;
+};
+
+int write_dyn_array_header(File* filePtr, DynArrayFileHeader* fileHeader);
+int read_dyn_array_header(File* filePtr, DynArrayFileHeader* fileHeader);
+
+
+//-------- BEGIN OF CLASS DynArrayT ---------//
+
+template <class T>
+class DynArrayT
+{
+	static_assert(std::is_trivially_copyable<T>::value, "DynArrayT elements are moved with memcpy");
+
+public:
+	explicit DynArrayT(int blockNum=DEF_DYNARRAY_BLOCK_SIZE);
+	~DynArrayT();
+
+	int	size() const				{ return last_ele; }
+	int	capacity() const			{ return ele_num; }
+
+	T*		get(int recNo)				{ return recNo<1 || recNo>last_ele ? NULL : body_buf+recNo-1; }
+	T*		begin()						{ return body_buf; }
+	T*		end()							{ return body_buf+last_ele; }
+
+	void	reserve(int eleNum);
+	void	linkin(const T* ent);
+	void	append(const T* entArray, int count);
+	void	insert_at(int recNo, const T* ent);
+	void	linkout(int recNo);
+	void	zap(int resizeFlag=1);
+
+	template <class Compare> void sort(Compare cmpLess)				{ std::sort(begin(), end(), cmpLess); }
+	template <class Compare> void stable_sort(Compare cmpLess)		{ std::stable_sort(begin(), end(), cmpLess); }
+
+	int	write_file(File* filePtr);
+	int	read_file(File* filePtr);
+
+private:
+	DynArrayT(const DynArrayT&) = delete;
+	DynArrayT& operator=(const DynArrayT&) = delete;
+
+	void	grow(int minNum);
+
+private:
+	T*		body_buf;
+	int	ele_num;				// the no. of elements allocated
+	int	last_ele;			// the no. of elements used
+	int	block_num;			// the initial no. of elements allocated
+};
+
+//--------- END OF CLASS DynArrayT ---------//
+
+
+//--------- BEGIN OF FUNCTION DynArrayT Constructor -------//
+//
+// [int] blockNum = the no. of elements allocated at first
+//						  (default : DEF_DYNARRAY_BLOCK_SIZE)
+//
+template <class T>
+DynArrayT<T>::DynArrayT(int blockNum)
+{
+	block_num = MAX(blockNum, 1);
+	ele_num   = block_num;
+	last_ele  = 0;
+	body_buf  = (T*) mem_add( sizeof(T)*ele_num );
+}
+//----------- END OF FUNCTION DynArrayT Constructor -----//
+
+
+//--------- BEGIN OF FUNCTION DynArrayT Destructor ------//
+//
+template <class T>
+DynArrayT<T>::~DynArrayT()
+{
+	mem_del( body_buf );
+}
+//---------- END OF FUNCTION DynArrayT Destructor --------//
+
+
+//--------- BEGIN OF FUNCTION DynArrayT::grow ---------//
+//
+// Grow the storage to hold at least minNum elements, doubling it each
+// time so that linking in n elements costs O(n) copying.
+//
+template <class T>
+void DynArrayT<T>::grow(int minNum)
+{
+	int newNum = MAX(ele_num*2, minNum);
+
+	body_buf = (T*) mem_resize( body_buf, sizeof(T)*newNum );
+	ele_num  = newNum;
+}
+//--------- END OF FUNCTION DynArrayT::grow -----------//
+
+
+//--------- BEGIN OF FUNCTION DynArrayT::reserve ---------//
+//
+template <class T>
+void DynArrayT<T>::reserve(int eleNum)
+{
+	if( eleNum > ele_num )
+	{
+		body_buf = (T*) mem_resize( body_buf, sizeof(T)*eleNum );
+		ele_num  = eleNum;
+	}
+}
+//--------- END OF FUNCTION DynArrayT::reserve -----------//
+
+
+//---------- BEGIN OF FUNCTION DynArrayT::linkin -----------//
+//
+// Link a record at the END of the array
+//
+// WARNING : After calling linkin() all pointers to the array body
+//           should be updated, as the body memory may be moved.
+//
+template <class T>
+void DynArrayT<T>::linkin(const T* ent)
+{
+	if( last_ele == ele_num )
+		grow(last_ele+1);
+
+	body_buf[last_ele++] = *ent;
+}
+//---------- END OF FUNCTION DynArrayT::linkin ------------//
+
+
+//---------- BEGIN OF FUNCTION DynArrayT::append -----------//
+//
+// Link a number of records at the END of the array
+//
+template <class T>
+void DynArrayT<T>::append(const T* entArray, int count)
+{
+	if( last_ele+count > ele_num )
+		grow(last_ele+count);
+
+	memcpy( body_buf+last_ele, entArray, sizeof(T)*count );
+	last_ele += count;
+}
+//---------- END OF FUNCTION DynArrayT::append ------------//
+
+
+//---------- BEGIN OF FUNCTION DynArrayT::insert_at -----------//
+//
+// Insert a record so that it becomes record recNo
+//
+template <class T>
+void DynArrayT<T>::insert_at(int recNo, const T* ent)
+{
+	err_when( recNo<1 || recNo>last_ele+1 );
+
+	if( last_ele == ele_num )
+		grow(last_ele+1);
+
+	memmove( body_buf+recNo, body_buf+recNo-1, sizeof(T)*(last_ele-recNo+1) );
+	body_buf[recNo-1] = *ent;
+	last_ele++;
+}
+//---------- END OF FUNCTION DynArrayT::insert_at ------------//
+
+
+//---------- BEGIN OF FUNCTION DynArrayT::linkout -----------//
+//
+template <class T>
+void DynArrayT<T>::linkout(int recNo)
+{
+	err_when( recNo<1 || recNo>last_ele );
+
+	memmove( body_buf+recNo-1, body_buf+recNo, sizeof(T)*(last_ele-recNo) );
+	last_ele--;
+}
+//---------- END OF FUNCTION DynArrayT::linkout ------------//
+
+
+//--------- BEGIN OF FUNCTION DynArrayT::zap ---------//
+//
+// [int] resizeFlag - whether resize the array to its initial size
+//							 or keep its current size.
+//							 (default:1)
+//
+template <class T>
+void DynArrayT<T>::zap(int resizeFlag)
+{
+	if( resizeFlag && ele_num != block_num )
+	{
+		ele_num  = block_num;
+		body_buf = (T*) mem_resize( body_buf, sizeof(T)*ele_num );
+	}
+
+	last_ele = 0;
+}
+//--------- END OF FUNCTION DynArrayT::zap -----------//
+
+
+//---------- Begin of function DynArrayT::write_file -------------//
+//
+// Write the array in the same format as DynArray::write_file().
+//
+// Return : 1 - write successfully
+//          0 - writing error
+//
+template <class T>
+int DynArrayT<T>::write_file(File* filePtr)
+{
+	DynArrayFileHeader fileHeader;
+
+	fileHeader.ele_num     = ele_num;
+	fileHeader.block_num   = block_num;
+	fileHeader.cur_pos     = last_ele;
+	fileHeader.last_ele    = last_ele;
+	fileHeader.ele_size    = sizeof(T);
+	fileHeader.sort_offset = -1;
+	fileHeader.sort_type   = 0;
+
+	if( !write_dyn_array_header(filePtr, &fileHeader) )
+		return 0;
+
+	if( last_ele > 0 )
+	{
+		if( !filePtr->file_write( body_buf, sizeof(T)*last_ele ) )
+			return 0;
+	}
+
+	return 1;
+}
+//------------- End of function DynArrayT::write_file --------------//
+
+
+//---------- Begin of function DynArrayT::read_file -------------//
+//
+// Read an array saved by write_file() or DynArray::write_file().
+//
+// Return : 1 - read successfully
+//          0 - reading error
+//
+template <class T>
+int DynArrayT<T>::read_file(File* filePtr)
+{
+	DynArrayFileHeader fileHeader;
+
+	if( !read_dyn_array_header(filePtr, &fileHeader) )
+		return 0;
+
+	if( fileHeader.ele_size != (int) sizeof(T) || fileHeader.last_ele < 0 )
+		return 0;
+
+	last_ele = 0;
+	reserve( fileHeader.last_ele );
+
+	if( fileHeader.last_ele > 0 )
+	{
+		if( !filePtr->file_read( body_buf, sizeof(T)*fileHeader.last_ele ) )
+			return 0;
+	}
+
+	last_ele = fileHeader.last_ele;
+
+	return 1;
+}
+//------------- End of function DynArrayT::read_file --------------//
+
+#endif
@@ -42,15 +42,30 @@ public:
 	int      handle_error;
 	FileType file_type;
 
+private:
+
+	enum { MEM_FILE_ALLOC_SIZE = 0x100000 };
+
+	char*    mem_buf;				// the data of a memory file, NULL for a disk file
+	long     mem_size;
+	long     mem_alloc_size;
+	long     mem_pos;
+
 public:
 
-	File(): file_handle(NULL) {}
+	File(): file_handle(NULL), mem_buf(NULL) {}
 	~File();
 
 	int   file_open(const char*, int=1, int=0);
 	int   file_create(const char*, int=1, int=0);
 	void  file_close();
 
+	int   file_create_mem(int=1, int=0);
+	int   file_open_mem(char*, long, int=1, int=0);
+	char* file_mem_buf()		{ return mem_buf; }
+
+	int   is_open()			{ return file_handle != NULL || mem_buf != NULL; }
+
 	long  file_size();
 	long  file_seek(long, int = SEEK_SET);
 	long  file_pos();
@@ -69,6 +84,11 @@ public:
 
 	int     file_put_long(int32_t);
 	int32_t file_get_long();
+
+private:
+
+	int   raw_write(const void*, unsigned);
+	int   raw_read(void*, unsigned);
 };
 
 #endif
@@ -0,0 +1,91 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : OFILEPRE.H
+//Description : Reading files ahead on worker threads
+
+#ifndef __OFILEPRE_H
+#define __OFILEPRE_H
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//-------- Define constant ---------//
+
+enum { FILE_PRELOAD_QUEUED=0,
+		 FILE_PRELOAD_READING,
+		 FILE_PRELOAD_DONE,
+		 FILE_PRELOAD_FAILED,
+		 FILE_PRELOAD_TAKEN };
+
+//------- Define struct FilePreloadEntry -------//
+
+struct FilePreloadEntry
+{
+	std::string		file_name;
+	char				status;
+	char*				data_buf;			// allocated with mem_add() by the reading thread
+	long				data_size;
+};
+
+//------- Define class FilePreload -------//
+//
+// Files that are about to be opened by a series of inits are read on
+// worker threads, in the order they will be needed. When one of them is
+// opened with File::file_open(), on any thread, the caller gets a memory
+// file with the data read ahead, waiting for the read to finish if
+// needed. Files that are only read in part should not be given, as
+// the whole file would be kept in memory.
+//
+class FilePreload
+{
+public:
+	FilePreload();
+	~FilePreload()		{ finish(); }
+
+	void		start(const std::vector<std::string>& fileNameArray);
+	void		finish();
+
+	int		take(const char* fileName, char*& dataBuf, long& dataSize);
+
+private:
+	void		read_main();
+
+private:
+	std::vector<FilePreloadEntry>	entry_array;
+	std::vector<std::thread>		thread_array;
+	std::mutex							preload_mutex;
+	std::condition_variable			preload_cond;
+
+	bool				active_flag;
+	bool				quit_flag;
+	unsigned			next_entry;						// the next entry to be read
+
+	unsigned long	taken_count;
+	unsigned long	wait_ms;							// the time spent by take() waiting for reads to finish
+};
+
+extern FilePreload file_preload;
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : OFIXED.H
+//Description : Fixed-point maths for the game simulation
+
+#ifndef __OFIXED_H
+#define __OFIXED_H
+
+#include <stdint.h>
+
+//-------- Define constant ---------//
+//
+// A fixed-point value is an int holding the value times FIXED_ONE.
+// Angles are in quarters of a degree, FIXED_CIRCLE for a full circle.
+//
+// The simulation must give the same results on every computer in a
+// multiplayer game, and the sin() and cos() of the C library differ
+// between processors and library versions. These are worked out
+// from a table with integer maths only.
+//
+#define FIXED_SHIFT				16
+#define FIXED_ONE					(1 << FIXED_SHIFT)
+
+#define FIXED_DEGREE				4
+#define FIXED_CIRCLE				(360*FIXED_DEGREE)
+
+//------- Define functions -------//
+
+int	fixed_sin(int angle);
+int	fixed_cos(int angle);
+
+//--------- Begin of inline function fixed_mul ---------//
+//
+// Multiply a value by a fixed-point value. The result is truncated
+// towards zero, as converting a double to an int does.
+//
+// <int> value      = the value
+// <int> fixedValue = the fixed-point value
+//
+inline int fixed_mul(int value, int fixedValue)
+{
+	return (int) ( (int64_t) value * fixedValue / FIXED_ONE );
+}
+//----------- End of inline function fixed_mul ---------//
+
+#endif
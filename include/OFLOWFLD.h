@@ -0,0 +1,119 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OFLOWFLD.H
+//Description : Flow fields shared by the units of large group moves
+
+#ifndef __OFLOWFLD_H
+#define __OFLOWFLD_H
+
+#include <stdint.h>
+
+#ifndef __GAMEDEF_H
+#include <GAMEDEF.h>
+#endif
+
+struct ResultNode;
+
+//-------- Define constant ---------//
+
+#define MIN_FLOW_FIELD_UNIT_COUNT	50		// land units moving together use a flow field from this many units on
+#define MAX_FLOW_FIELD					4
+#define MAX_FLOW_FIELD_GROUP			16
+#define FLOW_FIELD_EXPIRE_FRAMES		600	// a field not used for this many frames is freed
+#define FLOW_FIELD_SEEK_RANGE			8		// units leave the field this close to their own destination
+
+//------- Define class FlowField -------//
+//
+// The distance of every land location to the destination of a group
+// move, built with one breadth-first pass over World::pass_map. Each
+// unit of the group walks down the distances to near its own place in
+// the formation, and only seeks a path for the last few locations.
+//
+class FlowField
+{
+public:
+	short		dest_x_loc, dest_y_loc;
+	short		dest_range;							// units with destinations this close to dest_?_loc may use the field
+	char		nation_recno;						// 0 if the field is not kept out of hostile territory
+	char		nation_passable[MAX_NATION];	// Nation::relation_passable_array when nation_recno is set
+	int		pass_change_count;				// World::pass_change_count when the distances were calculated
+	int		power_change_count;				// World::power_change_count then, only checked when nation_recno is set
+	uint32_t	last_used_frame;
+
+	unsigned short* dist_array;				// the distance of each location to the destination, FLOW_FIELD_UNREACHED if it cannot get there
+
+public:
+	FlowField()		{ dist_array=NULL; }
+	~FlowField()	{ deinit(); }
+
+	void	init(int destXLoc, int destYLoc, int destRange, int nationRecno, char* nationPassable);
+	void	deinit();
+
+	int	is_inited()		{ return dist_array!=NULL; }
+
+	int	can_use(int startXLoc, int startYLoc, int destXLoc, int destYLoc);
+	ResultNode* get_path(int startXLoc, int startYLoc, int destXLoc, int destYLoc, uint32_t groupId, int& nodeCount, short& pathDist);
+
+private:
+	void	calc_dist();
+	int	is_out_of_date();
+	int	is_passable(int xLoc, int yLoc);
+	int	can_step(int xLoc, int yLoc, int stepX, int stepY);
+};
+
+//------- Define struct FlowFieldGroup -------//
+
+struct FlowFieldGroup
+{
+	uint32_t	group_id;		// Unit::unit_group_id of the units using the field
+	char		field_id;		// 1-based index of FlowFieldArray::field_array, 0 if the entry is not used
+};
+
+//------- Define class FlowFieldArray -------//
+//
+// The fields are not saved. They are rebuilt from the map when it has
+// changed, and a group without a field seeks paths as before. As the
+// groups moving when a game is saved lose their fields when it is
+// loaded, the loaded game does not move its units exactly as the same
+// game left running, like SeekPathCache.
+//
+class FlowFieldArray
+{
+public:
+	FlowField		field_array[MAX_FLOW_FIELD];
+	FlowFieldGroup	group_array[MAX_FLOW_FIELD_GROUP];
+	int				next_group_slot;		// the entry in group_array to be replaced next
+
+public:
+	FlowFieldArray();
+
+	void			deinit();
+
+	void			add_group(uint32_t groupId, int destXLoc, int destYLoc, int destRange, int nationRecno);
+	FlowField*	get_field(uint32_t groupId, int destXLoc, int destYLoc);
+
+private:
+	void			free_unused_field();
+};
+
+extern FlowFieldArray flow_field_array;
+
+#endif
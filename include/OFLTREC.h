@@ -0,0 +1,93 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OFLTREC.H
+//Description : Flight recorder, the last records of the simulation kept in
+//              all builds and written to FLIGHTn.REC when a multiplayer
+//              sync error or a fatal error happens. tools/fltrecdiff shows
+//              where the dumps of two players start to differ.
+
+#ifndef __OFLTREC_H
+#define __OFLTREC_H
+
+#include <atomic>
+#include <stdint.h>
+
+//------- Define constants -------//
+
+enum { MAX_FLIGHT_RECORD = 0x10000,		// must be a power of 2
+		 MAX_FLIGHT_SITE = 256,
+		 FLIGHT_SITE_NAME_LEN = 32 };
+
+//------- Define struct FlightRecord -------//
+
+#pragma pack(1)
+struct FlightRecord
+{
+	uint32_t frame;			// sys.frame_count
+	uint16_t site_id;			// FLIGHT_REC() call site, see FlightRecorder::add_site()
+	uint16_t reserved;
+	int32_t  seed;				// misc.get_random_seed()
+	int32_t  value;			// given by the call site
+};
+#pragma pack()
+
+//------- Define class FlightRecorder -------//
+//
+// Records are written into a ring buffer without locking or allocating,
+// so FLIGHT_REC() can be left in release builds. Only the last
+// MAX_FLIGHT_RECORD records are kept.
+//
+class FlightRecorder
+{
+public:
+	FlightRecorder();
+
+	void	init();
+
+	int	add_site(const char* siteName);
+	void	record(int siteId, int value);
+
+	void	dump(const char* reason);
+
+private:
+	FlightRecord		record_array[MAX_FLIGHT_RECORD];
+	std::atomic<uint32_t> record_count;
+
+	const char*			site_name_array[MAX_FLIGHT_SITE];
+	std::atomic<int>	site_count;
+
+	char					dump_flag;		// only the first error of a game is dumped
+};
+
+extern FlightRecorder flight_recorder;
+
+//------- Define macro FLIGHT_REC -------//
+//
+// <const char*> siteName - string literal naming the call site
+// <int>         value    - value to record, e.g. the size of an array
+//
+#define FLIGHT_REC(siteName, value) \
+	do { \
+		static const int flightSiteId = flight_recorder.add_site(siteName); \
+		flight_recorder.record(flightSiteId, value); \
+	} while(0)
+
+#endif
@@ -200,6 +200,9 @@ public:
 
 private:
 	void put_paragraph_line(int x1, int y1, const char *textPtr, const char *textPtrEnd, char *flag_under_line);
+
+	int  calc_text_width(const char* textPtr, int textPtrLen, int maxDispWidth);
+	char* draw_span(const char* textPtr, short& needWidth, short& lastX);
 };
 
 extern Font font_san, font_std, font_small, font_mid, font_news;
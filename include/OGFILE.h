@@ -39,8 +39,15 @@ public:
    // Loads the saved game given by directory and fileName. Updates saveGameInfo in with the new savegame information. Returns 1, 0, or -1 for success, recoverable failure, failure.
    static int load_game(const char* filePath, SaveGameInfo* /*out*/ saveGameInfo);
 
+   // Saves the current game into a memory file, as it would be saved in a file. Returns true on success.
+   static bool save_game_mem(File* filePtr, const SaveGameInfo& saveGameInfo);
+   // Loads a game saved by save_game_mem() from a memory file. Returns 1, 0, or -1 for success, recoverable failure, failure.
+   static int load_game_mem(File* filePtr, SaveGameInfo* /*out*/ saveGameInfo);
+
    // Reads the given file and fills the save game info from the header. Returns true if successful.
    static bool read_header(const char* filePath, SaveGameInfo* /*out*/ saveGameInfo);
+   // Loads the game data of the given file and writes it again to memory. Returns 1 if the bytes are the same, 0 if not, -1 if it cannot be loaded.
+   static int check_round_trip(const char* filePath);
    static const char *status_str();
 
 public:
@@ -52,6 +59,11 @@ private:
    static void  save_process();
    static void  load_process();
    static int   write_game_header(const SaveGameInfo& saveGameInfo, File* filePtr);
+   static int   write_game(const SaveGameInfo& saveGameInfo, File* filePtr);
+   static int   read_game(File* filePtr, SaveGameHeader* saveGameHeader);
+
+   static int   write_compressed(File* gameDataFile, File* filePtr);
+   static int   read_compressed(File* filePtr, File* gameDataFile);
 
    static int   write_file(File*);
    static int   write_file_1(File*);
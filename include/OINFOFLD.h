@@ -0,0 +1,74 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : OINFOFLD.H
+//Description : Values of the info panel fields on the screen
+
+#ifndef __OINFOFLD_H
+#define __OINFOFLD_H
+
+class Font;
+
+//-------- Define constant ---------//
+
+#define MAX_INFO_FIELD				64
+#define MAX_INFO_FIELD_TEXT		40
+
+//------- Define struct InfoField -------//
+
+struct InfoField
+{
+	Font*		font_ptr;					// NULL if the entry is not used
+	short		x, y;							// the position passed to Font::field()
+	short		last_x;						// the x coordination of the last pixel of the value
+	char		text[MAX_INFO_FIELD_TEXT+1];
+};
+
+//------- Define class InfoFieldCache -------//
+//
+// Keeps the value shown in each field drawn by Font::field() on the
+// front buffer. On INFO_UPDATE, a field is only drawn again if its
+// value has changed.
+//
+// All fields are forgotten when Info::disp() repaints the panel, and a
+// field is forgotten when VgaUtil::blt_buf() copies over it.
+//
+class InfoFieldCache
+{
+public:
+	InfoField	field_array[MAX_INFO_FIELD];
+
+public:
+	InfoFieldCache()		{ clear(); }
+
+	void		clear();
+	void		clear_area(int x1, int y1, int x2, int y2);
+
+	int		get_field(Font* fontPtr, int x, int y, const char* textPtr, int& lastX);
+	void		set_field(Font* fontPtr, int x, int y, const char* textPtr, int lastX);
+
+private:
+	InfoField* find_field(Font* fontPtr, int x, int y);
+};
+
+extern InfoFieldCache info_field_cache;
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : OINITGRF.H
+//Description : Steps of initialization and the steps each one needs
+
+#ifndef __OINITGRF_H
+#define __OINITGRF_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+//------- Define struct InitStep -------//
+
+struct InitStep
+{
+	const char*					name;
+	std::function<void()>	init_func;
+	std::vector<int>			depend_array;		// the steps that must be done first
+	std::vector<std::string> file_array;		// the files it reads in whole, read ahead by file_preload
+	char							thread_flag;		// whether it can be run on a worker thread
+
+	double						run_ms;
+	double						finish_ms;			// when it would finish if each step started as soon as the steps it needs are done
+	int							critical_step;		// the step in depend_array finishing last, -1 if none
+};
+
+//------- Define class InitGraph -------//
+//
+// Steps added with threadFlag set are run on worker threads once the
+// steps they need are done. The others are run on the calling thread in
+// the order they are added, as they use shared objects like game_set,
+// its Database and misc. While they run, the files they read are read
+// ahead on worker threads by file_preload.
+//
+// The time of each step is printed, together with the longest chain of
+// steps that depend on each other.
+//
+class InitGraph
+{
+public:
+	InitGraph(const char* graphName);
+
+	int	add_step(const char* stepName, std::function<void()> initFunc,
+						std::vector<int> dependArray = std::vector<int>(),
+						std::vector<std::string> fileArray = std::vector<std::string>(),
+						int threadFlag = 0);
+	void	run();
+
+private:
+	const char*				graph_name;
+	std::vector<InitStep>	step_array;
+};
+
+#endif
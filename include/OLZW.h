@@ -32,6 +32,7 @@ class BitStream				// for reading token less than 16 bits
 {
 public:
 	long bit_offset;
+	char overrun_flag;		// set when reading past the end of the data
 
 public:
 	BitStream();
@@ -44,9 +45,10 @@ class BitMemStream : public BitStream
 {
 protected:
 	unsigned char *bytePtr;
+	long bit_len;				// no. of bits that can be read, -1 if not limited
 
 public:
-	BitMemStream(unsigned char *p);
+	BitMemStream(unsigned char *p, long bitLen=-1);
 	unsigned short input_bits(unsigned stringLen);
 	void output_bits(unsigned short stringCode, unsigned stringLen);
 };
@@ -113,7 +115,7 @@ public:
 private:
 	void initialize_dictionary();
 	unsigned short find_child_node( unsigned short parent_code, unsigned char child_character );
-	unsigned int decode_string( unsigned int count, unsigned short code );
+	int decode_string( unsigned int count, unsigned short code );
 };
 
 #endif
\ No newline at end of file
@@ -129,10 +129,10 @@ public:
 									{ return loc_flag & teraMask; }
 	void	walkable_reset();
 	// void	walkable_on()		{ loc_flag |= LOCATE_WALK_LAND; }
-	void	walkable_off()		{ loc_flag &= ~(LOCATE_WALK_LAND | LOCATE_WALK_SEA); }
+	void	walkable_off();
 
-	void	walkable_on(int teraMask)		{ loc_flag |= teraMask; }
-	void	walkable_off(int teraMask)		{ loc_flag &= ~teraMask; }
+	void	walkable_on(int teraMask);
+	void	walkable_off(int teraMask);
 
 	int	is_coast()			{ return loc_flag & LOCATE_COAST; }
 
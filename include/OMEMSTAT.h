@@ -0,0 +1,82 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OMEMSTAT.H
+//Description : Memory accounting of mem_add() and mem_del() in normal
+//              builds, by source file and by subsystem. Shown with the
+//              AI info display and written to MEMSTAT.LOG in the
+//              config directory.
+
+#ifndef __OMEMSTAT_H
+#define __OMEMSTAT_H
+
+//------- Define constants -------//
+
+enum { MAX_MEM_ACCOUNT = 256 };			// source files allocating memory
+
+enum MemSubsystem
+{
+	MEM_SUBSYSTEM_OTHER,
+	MEM_SUBSYSTEM_DYNARRAY,
+	MEM_SUBSYSTEM_SEEK_PATH,
+	MEM_SUBSYSTEM_RESOURCE,
+	MEM_SUBSYSTEM_VLEN_QUEUE,
+
+	MEM_SUBSYSTEM_COUNT
+};
+
+//------- Define static class MemStat -------//
+//
+// Each block is allocated with a small header keeping its size and the
+// account of the source file that allocated it, so mem_del() knows what
+// to take off. All data is zero initialized, so blocks can be allocated
+// by constructors of other global objects.
+//
+class MemStat
+{
+public:
+	static int		add_account(const char* fileName);
+
+	static char*	add(unsigned memSize, int accountId);
+	static char*	add_clear(unsigned memSize, int accountId);
+	static char*	resize(void* orgPtr, unsigned memSize, int accountId);
+	static void		del(void* memPtr);
+
+	static void		next_frame();
+
+	static void		start_leak_check();
+	static void		end_leak_check();
+
+	static void		dump(const char* reason);
+	static void		draw_profile();
+
+private:
+	MemStat() = delete;
+};
+
+//------- Define macro MEM_ACCOUNT_ID -------//
+//
+// The account of the source file of the call site, looked up once for
+// each call site.
+//
+#define MEM_ACCOUNT_ID() \
+	([]{ static const int memAccountId = MemStat::add_account(__FILE__); return memAccountId; }())
+
+#endif
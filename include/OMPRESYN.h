@@ -0,0 +1,106 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OMPRESYN.H
+//Description : Multiplayer resync, the game state of one player sent to
+//              all other players during the game, instead of everyone
+//              saving and reloading it.
+
+#ifndef __OMPRESYN_H
+#define __OMPRESYN_H
+
+#include <stdint.h>
+
+#ifndef __OFILE_H
+#include <OFILE.h>
+#endif
+
+//------- Define struct ResyncDataHeader -------//
+//
+// The header of each MSG_RESYNC_DATA message, followed by data_size
+// bytes of the saved game.
+//
+#pragma pack(1)
+struct ResyncDataHeader
+{
+	uint32_t frame;				// the frame the state was saved in
+	uint32_t state_size;			// size of the saved game
+	uint32_t offset;				// where the data goes in the saved game
+	uint32_t data_size;
+};
+#pragma pack()
+
+//------- Define class MpResync -------//
+//
+// When the sync testing finds the players out of sync, the human player
+// with the lowest nation recno requests a resync. At the agreed frame it
+// saves the game into memory and sends it in chunks, while all other
+// players wait at that frame and load it once every chunk has arrived.
+// The sender then loads the same saved game, so that all players go on
+// from the state just loaded. Nothing is written to disk.
+//
+class MpResync
+{
+public:
+	enum { CHUNK_SIZE = 8192 };
+
+public:
+	MpResync();
+	~MpResync();
+
+	void	init();
+
+	void	process();
+
+	void	request(uint32_t resyncFrame, short sourceNationRecno);
+	void	add_data(char* dataPtr);
+
+private:
+	int	is_source();
+	void	send_request();
+	void	resync_now();
+
+	int	send_state();
+	int	receive_state();
+	int	load_state();
+
+	void	free_state();
+
+private:
+	char		request_sent_flag;		// this player has requested a resync that is not done yet
+	char		request_flag;
+	uint32_t	resync_frame;
+	short		source_nation_recno;		// the player whose game state is sent
+
+	uint32_t	settle_frame;				// sync testing is resumed in this frame, 0 if not suspended
+	char		settle_sync_test_level;
+
+	File		state_file;					// the saved game, a memory file
+	uint32_t	state_size;
+
+	unsigned char*	state_buf;				// the chunks received, state_file takes it over when loading
+	unsigned char*	chunk_received_buf;	// a bit for each chunk, set when it has been received
+	uint32_t	chunk_count;
+	uint32_t	received_chunk_count;
+};
+
+extern MpResync mp_resync;
+
+#endif
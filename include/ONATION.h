@@ -496,6 +496,7 @@ public:
 
 	int 			attack_enemy_town_defense(Town* targetTown, int useAllCamp=0);
 	Town* 		think_capture_enemy_town_target(Town* capturerTown);
+	int 			rate_capture_enemy_town_target(Town* capturerTown, Town* targetTown, int ourMilitary, int& curRating, int& townCombatLevel);
 	int 			enemy_town_combat_level(Town* targetTown, int returnIfWar, int& hasWar);
 	int 			enemy_firm_combat_level(Firm* targetFirm, int returnIfWar, int& hasWar);
 	int 			mobile_defense_combat_level(int targetXLoc, int targetYLoc, int targetNationRecno, int returnIfWar, int& hasWar);
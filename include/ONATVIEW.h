@@ -0,0 +1,98 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : ONATVIEW.H
+//Description : Header file for NationViewArray, per-nation lists of
+//              units, firms and towns kept in step with the game arrays
+//              so that the report screens need not scan them. It is not
+//              saved, and is regenerated from the arrays after loading.
+
+#ifndef __ONATVIEW_H
+#define __ONATVIEW_H
+
+#include <vector>
+
+#ifndef __GAMEDEF_H
+#include <GAMEDEF.h>
+#endif
+
+#ifndef __OFIRMID_H
+#include <OFIRMID.h>
+#endif
+
+#ifndef __OUNITRES_H
+#include <OUNITRES.h>
+#endif
+
+//------- Define class NationView --------//
+//
+// All lists are in ascending recno order, the same order in which the
+// reports used to find them by scanning the arrays. The lists include
+// units that are dying and towns that are being abandoned, as these are
+// still in the arrays, callers should filter them with is_deleted().
+//
+class NationView
+{
+public:
+	std::vector<short> general_list;				// generals and the king
+	std::vector<short> unit_list[MAX_UNIT_TYPE];	// all units, by unit id
+	std::vector<short> firm_list[MAX_FIRM_TYPE];	// all firms, by firm id
+	std::vector<short> town_list;
+
+public:
+	void 	clear();
+
+	std::vector<short>& units(int unitId)	{ return unit_list[unitId-1]; }
+	std::vector<short>& firms(int firmId)	{ return firm_list[firmId-1]; }
+};
+
+//------- Define class NationViewArray --------//
+//
+// Called by Unit, Firm and Town when they are added, removed or change
+// nation. Independent units, firms and towns are kept under nation 0.
+//
+class NationViewArray
+{
+public:
+	void 	init();
+	void 	deinit();
+
+	NationView* operator[](int nationRecno);
+
+	void	add_unit(int unitRecno, int nationRecno, int unitId, int rankId);
+	void	del_unit(int unitRecno, int nationRecno, int unitId, int rankId);
+
+	void	add_firm(int firmRecno, int nationRecno, int firmId);
+	void	del_firm(int firmRecno, int nationRecno, int firmId);
+
+	void	add_town(int townRecno, int nationRecno);
+	void	del_town(int townRecno, int nationRecno);
+
+	void	recreate_after_load();		// regenerate all lists from unit_array, firm_array and town_array
+
+private:
+	NationView view_array[MAX_NATION+1];
+};
+
+extern NationViewArray nation_view_array;
+
+//-------------------------------------------//
+
+#endif
@@ -0,0 +1,142 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OPARALEL.H
+//Description : Evaluating independent jobs on worker threads
+//
+// parallel_for() is for the read-only scoring loops of the AI. The job
+// for index i may only read the game state and write the result slot i,
+// it must not call misc.random() or change anything else. The caller
+// then goes through the results serially in index order, so the outcome
+// is the same on every machine whatever the no. of threads.
+//
+// The FPU control word (precision and rounding) is per thread, so the
+// calling thread's is copied to the worker threads before they start,
+// their floating point results are then the same as the caller's.
+
+#ifndef __OPARALEL_H
+#define __OPARALEL_H
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#if !defined(__GNUC__) || !(defined(__i386__) || defined(__x86_64__))
+#include <cfenv>
+#endif
+
+//------- Define constant -------//
+
+enum { MAX_PARALLEL_THREAD = 8 };
+
+//------- Define struct ParallelFpuState -------//
+//
+// The floating point control of a thread, see the notes above.
+//
+struct ParallelFpuState
+{
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+
+	unsigned short	x87_control_word;
+#ifdef __SSE__
+	unsigned int	mxcsr;
+#endif
+
+	void save()
+	{
+		__asm__ __volatile__ ("fnstcw %0" : "=m" (x87_control_word));
+#ifdef __SSE__
+		__asm__ __volatile__ ("stmxcsr %0" : "=m" (mxcsr));
+#endif
+	}
+
+	void load()
+	{
+		__asm__ __volatile__ ("fldcw %0" : : "m" (x87_control_word));
+#ifdef __SSE__
+		__asm__ __volatile__ ("ldmxcsr %0" : : "m" (mxcsr));
+#endif
+	}
+
+#else
+
+	std::fenv_t		fenv;
+
+	void save()		{ std::fegetenv(&fenv); }
+	void load()		{ std::fesetenv(&fenv); }
+
+#endif
+};
+
+//------- Begin of function parallel_for -------//
+//
+// Call func(i) for i = 0 to count-1, splitting the range into
+// contiguous parts on up to MAX_PARALLEL_THREAD threads. The calling
+// thread takes the first part. The worker threads get the FPU control
+// word of the calling thread.
+//
+// <int>  count           - the no. of jobs
+// <int>  minJobPerThread - don't start a thread for fewer jobs than this,
+//                          as starting one costs more than a few cheap jobs
+// <Func> func            - void func(int i)
+//
+template <class Func>
+void parallel_for(int count, int minJobPerThread, Func func)
+{
+	int threadCount = std::min( (int) std::thread::hardware_concurrency(), (int) MAX_PARALLEL_THREAD );
+
+	threadCount = std::min( threadCount, count / std::max(minJobPerThread, 1) );
+
+	if( threadCount <= 1 )
+	{
+		for( int i=0 ; i<count ; i++ )
+			func(i);
+		return;
+	}
+
+	std::vector<std::thread> threadArray;
+	int jobPerThread = (count+threadCount-1) / threadCount;
+
+	ParallelFpuState fpuState;
+
+	fpuState.save();
+
+	for( int t=1 ; t<threadCount ; t++ )
+	{
+		int i1 = t * jobPerThread;
+		int i2 = std::min( i1+jobPerThread, count );
+
+		threadArray.emplace_back( [&func, &fpuState, i1, i2]() {
+			fpuState.load();
+
+			for( int i=i1 ; i<i2 ; i++ )
+				func(i);
+		} );
+	}
+
+	for( int i=0 ; i<jobPerThread ; i++ )
+		func(i);
+
+	for( size_t t=0 ; t<threadArray.size() ; t++ )
+		threadArray[t].join();
+}
+//------- End of function parallel_for -------//
+
+#endif
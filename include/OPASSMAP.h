@@ -0,0 +1,67 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OPASSMAP.H
+//Description : 2 bits per location copies of the Location flags read by
+//              path seeking and placement, four locations in a byte.
+
+#ifndef __OPASSMAP_H
+#define __OPASSMAP_H
+
+//------- Define the bits of World::pass_map -------//
+
+enum { PASS_LAND = 0x01,		// same as LOCATE_WALK_LAND, walkable by land units
+		 PASS_SEA  = 0x02 };		// same as LOCATE_WALK_SEA, sailable by ships
+
+//------- Define the bits of World::occupy_map -------//
+
+enum { OCCUPY_GROUND = 0x01,	// a land or sea unit is in the location
+		 OCCUPY_AIR    = 0x02 };	// an air unit is in the location
+
+//------- Define the bits of World::build_map -------//
+
+enum { BUILD_NO_SITE  = 0x01,	// the location has no raw site
+		 BUILD_POWER_ON = 0x02 };	// the location is not powered off
+
+//------- Define class PassMap -------//
+
+class PassMap
+{
+public:
+	unsigned char* bit_buf;
+	int				loc_count;
+
+public:
+	PassMap()		{ bit_buf=0; loc_count=0; }
+	~PassMap()		{ deinit(); }
+
+	void	init(int locCount);
+	void	deinit();
+
+	int	get(int locOffset)
+			{ return (bit_buf[locOffset>>2] >> ((locOffset&3)<<1)) & 3; }
+
+	void	set(int locOffset, int locBits)
+			{ unsigned char& bitByte = bit_buf[locOffset>>2];
+			  int bitShift = (locOffset&3)<<1;
+			  bitByte = (bitByte & ~(3<<bitShift)) | (locBits<<bitShift); }
+};
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OREACH.H
+//Description : Connected areas of the pass map, for telling whether a
+//              location can be reached without seeking a path.
+
+#ifndef __OREACH_H
+#define __OREACH_H
+
+class PassMap;
+
+//------- Define class ReachMap -------//
+//
+// Unlike the region ids set when the map is generated, the connected
+// areas follow walls, buildings, plants and hills as they are added and
+// removed. Locations are connected when they are adjacent, including
+// diagonally, and both walkable or both sailable.
+//
+// A location becoming passable joins the areas around it. A location
+// becoming impassable only needs the areas to be labelled again when it
+// may split them, which is done before the next query.
+//
+class ReachMap
+{
+public:
+	PassMap*	pass_map;
+	int		map_width, map_height;
+
+	int*		loc_conn_id;			// the connected area id. of each location, 0 if impassable
+	int*		conn_parent;			// connected areas joined together point to the one with the lowest id.
+	int		conn_count;
+
+	char		relabel_flag;			// the areas must be labelled again before the next query
+
+public:
+	ReachMap();
+	~ReachMap()		{ deinit(); }
+
+	void	init(PassMap* passMap, int mapWidth, int mapHeight);
+	void	deinit();
+
+	void	loc_opened(int locOffset);
+	void	loc_closed(int locOffset, int oldPassType);
+
+	int	get_conn(int xLoc, int yLoc, int passType);
+
+	static int pass_type(int passBits);
+
+private:
+	void	relabel();
+	int	find_conn(int connId);
+	void	join_conn(int connId1, int connId2);
+};
+
+#endif
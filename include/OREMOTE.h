@@ -167,6 +167,8 @@ enum { MSG_QUEUE_HEADER=FIRST_REMOTE_MSG_ID,
 		 MSG_U_SHIP_COPY_ROUTE,
 		 MSG_FIRM_REQ_BUILDER,
 		 MSG_F_MARKET_RESTOCK,
+		 MSG_REQUEST_RESYNC,
+		 MSG_RESYNC_DATA,
 
 		 LAST_REMOTE_MSG_ID			// keep this item last
 	  };
@@ -316,6 +318,9 @@ public:
 	void	caravan_copy_route();
 	void	firm_request_builder();
 	void	market_switch_restock();
+
+	void	request_resync();
+	void	resync_data();
 };
 
 //----------- Define class Remote -----------//
@@ -397,6 +402,7 @@ public:
 	// ###### patch begin Gilbert 22/1 #######//
 	char				sync_test_level;			// 0=disable, bit0= random seed, bit1=crc
 	// ###### patch end Gilbert 22/1 #######//
+	char				start_sync_test_level;	// sync_test_level when the game started, restored after a resync
 	int				process_frame_delay;
 
 	// --------- alternating send frame --------//
@@ -426,7 +432,7 @@ public:
 	int				connect_game();
 	void			start_game();
 
-	void 			send_msg(RemoteMsg* remoteMsgPtr, uint32_t receiverId=0);
+	int 			send_msg(RemoteMsg* remoteMsgPtr, uint32_t receiverId=0);
 	void 			send_free_msg(RemoteMsg* remoteMsgPtr, uint32_t receiverId=0);
 
 	RemoteMsg* 		new_msg(uint32_t msgId, int dataSize);
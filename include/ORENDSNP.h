@@ -0,0 +1,91 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : ORENDSNP.H
+//Description : Unit positions of the last two frames, for drawing units
+//              between frames
+
+#ifndef __ORENDSNP_H
+#define __ORENDSNP_H
+
+#include <stdint.h>
+
+class Sprite;
+
+//-------- Define constant ---------//
+
+#define RENDER_MIN_FRAME_MS		33		// interpolate only when frames are further apart than two screen refreshes
+#define RENDER_MAX_MOVE				64		// a unit moving more than this no. of pixels in a frame has not walked there
+
+//------- Define struct RenderPos -------//
+
+struct RenderPos
+{
+	short		x, y;			// Sprite::cur_x & cur_y, x is -1 if the unit was not on the map
+};
+
+//------- Define class RenderSnapshot -------//
+//
+// The map is redrawn every 16 milliseconds while the game runs at a
+// lower frame rate. The positions of the units are taken after each
+// frame is processed, and between frames the units are drawn part of
+// the way from their positions in the previous frame to the current
+// ones, so they walk smoothly instead of jumping once a frame.
+//
+// Only the drawing uses it. Sprite::cur_x and cur_y are moved while a
+// unit is drawn and put back right after. The positions are kept by
+// recno, so they are cleared when a unit is deleted, as a new unit may
+// be given its recno.
+//
+class RenderSnapshot
+{
+public:
+	RenderPos*	prev_pos_array;
+	RenderPos*	cur_pos_array;
+	int			pos_count;					// no. of units in cur_pos_array
+	int			prev_pos_count;
+
+	uint32_t		take_time;					// misc.get_time() when cur_pos_array was taken
+	uint32_t		frame_ms;					// the time between the last two frames
+	int			take_count;
+
+	int			draw_ratio;					// 0 to 256, how far units are drawn from the previous frame to the current one
+
+	short			saved_x, saved_y;			// cur_x & cur_y of the unit being drawn
+
+public:
+	RenderSnapshot();
+	~RenderSnapshot()		{ deinit(); }
+
+	void		deinit();
+
+	void		take();
+	void		begin_draw();
+
+	void		shift(Sprite* spritePtr);
+	void		unshift(Sprite* spritePtr);
+
+	void		del_unit(int unitRecno);
+};
+
+extern RenderSnapshot render_snapshot;
+
+#endif
@@ -0,0 +1,136 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : ORESBAKE.H
+//Description : Baked copies of the resource tables read from DBF files
+
+#ifndef __ORESBAKE_H
+#define __ORESBAKE_H
+
+#include <stdint.h>
+
+#include <FilePath.h>
+
+class Database;
+
+//-------- Define constant ---------//
+
+#define RES_BAKE_FILE_NAME		"RESBAKE.DAT"
+#define RES_BAKE_VERSION		2			// increase it when the layout of any baked record struct changes
+#define MAX_RES_BAKE_TABLE		16
+#define RES_BAKE_NAME_LEN		11			// the DBF names, e.g. "TOWNSLOT", are up to 8 characters
+#define RES_BAKE_ALIGN			8			// the table data in the file start at a multiple of this
+
+//------- Define struct ResBakeFileHeader -------//
+
+struct ResBakeFileHeader
+{
+	char		magic[4];				// "7KRB"
+	uint32_t	version;					// RES_BAKE_VERSION
+	uint32_t	table_count;
+	uint32_t	file_size;
+};
+
+//------- Define struct ResBakeSource -------//
+//
+// Where the DBF a table is parsed from is, for telling whether it has
+// changed without reading it.
+//
+struct ResBakeSource
+{
+	int64_t	mod_time;				// FileInfo::mod_time of the set file
+	uint32_t	file_size;				// size of the set file
+	uint32_t	offset;					// where the DBF is in the set file
+	uint32_t	size;						// size of the DBF
+	uint32_t	padding;					// always 0
+};
+
+//------- Define struct ResBakeTableInfo -------//
+//
+// The table directory follows ResBakeFileHeader in the file.
+//
+struct ResBakeTableInfo
+{
+	char		name[RES_BAKE_NAME_LEN+1];
+	uint32_t	rec_size;				// sizeof() the record struct
+	uint32_t	rec_count;
+	uint32_t	data_offset;			// from the start of the file
+	ResBakeSource src;				// the DBF the table was parsed from
+};
+
+//------- Define struct ResBakeTable -------//
+
+struct ResBakeTable
+{
+	ResBakeTableInfo info;
+
+	char*		data_ptr;
+	char		data_allocated;		// whether data_ptr was allocated by add_table(), or points into ResourceBake::file_buf
+};
+
+//------- Define class ResourceBake -------//
+//
+// The large resource tables with fixed size records and no pointers are
+// kept in RESBAKE.DAT in the config directory after they are parsed from
+// their DBF files. The next time the table is loaded, the records are
+// copied from the file instead of being parsed again, unless the set
+// file containing the DBF has changed. Only its size, modification time
+// and index are checked, so the DBF is not read at all.
+//
+class ResourceBake
+{
+public:
+	char				init_flag;
+	char				changed_flag;			// whether tables have been added since the file was read
+
+	char*				file_buf;
+	int				table_count;
+	ResBakeTable	table_array[MAX_RES_BAKE_TABLE];
+
+	unsigned long	hit_count;
+	unsigned long	miss_count;
+
+	char				set_file_name[FilePath::MAX_FILE_PATH];		// the set file set_mod_time and set_file_size are of
+	int64_t			set_mod_time;
+	uint32_t			set_file_size;
+
+public:
+	ResourceBake();
+	~ResourceBake()		{ deinit(); }
+
+	void		init();
+	void		deinit();
+
+	long		find_table(const char* tableName, int recSize);
+	void		copy_table(const char* tableName, void* recArray);
+	void		add_table(const char* tableName, Database* dbPtr, void* recArray, int recSize);
+	void		save();
+
+private:
+	int		read_file();
+	int		get_source(const char* tableName, ResBakeSource& src);
+	void		free_table(ResBakeTable* tablePtr);
+	ResBakeTable* get_table(const char* tableName);
+};
+
+extern ResourceBake res_bake;
+
+#endif
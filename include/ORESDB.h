@@ -46,6 +46,7 @@ public:
     bool  initialized() { return init_flag; }
     void  deinit();
     void  init_imported(const char * filename, int cacheWholeFile, int useCommonBuffer = 0);
+    void  init_imported_buf(char* dataBuf, int dataBufSize);
     char* read_imported(long);
 };
 
@@ -220,6 +220,8 @@ public:
 	void	set_nation_recno(char nationRecno);
 	void	set_nation_passable(char nationPassable[]);
 	void	set_sub_mode(char subMode=SEARCH_SUB_MODE_NORMAL);
+	char	get_sub_mode();
+	char*	get_nation_passable();
 
    int   write_file(File* filePtr);
    int   read_file(File* filePtr);
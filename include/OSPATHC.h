@@ -0,0 +1,115 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OSPATHC.H
+//Description : Cache of the paths found by SeekPath, shared by all units
+
+#ifndef __OSPATHC_H
+#define __OSPATHC_H
+
+#include <stdint.h>
+
+#ifndef __GAMEDEF_H
+#include <GAMEDEF.h>
+#endif
+
+struct ResultNode;
+
+//-------- Define constant ---------//
+
+#define SEEK_PATH_CACHE_SIZE		256	// no. of paths kept, must be a power of 2
+#define SEEK_PATH_CACHE_CELL		16		// the width and height in locations of the cells tracking map changes
+
+//------- Define struct SeekPathCacheEntry -------//
+
+struct SeekPathCacheEntry
+{
+	short			start_x_loc, start_y_loc;
+	short			dest_x_loc, dest_y_loc;
+	char			mobile_type;
+	char			search_mode;
+	short			misc_no;
+	char			nation_recno;						// set if the path keeps out of the hostile territory of the nation
+	char			nation_passable[MAX_NATION];
+
+	uint32_t		change_stamp;						// SeekPathCache::change_stamp when the path was found
+	int			power_change_count;				// World::power_change_count then, only checked when nation_recno is set
+
+	ResultNode*	node_array;							// NULL if the entry is not used
+	int			node_count;
+	short			path_dist;
+};
+
+//------- Define class SeekPathCache -------//
+//
+// Units going back and forth between the same places, like caravans
+// and workers, get the path found last time instead of seeking it
+// again. A path is dropped when a location on or next to it has become
+// passable or impassable since it was found.
+//
+// The cache is not saved, it is emptied when a game is loaded. As a
+// cached path can differ from the one SeekPath would find, a game
+// loaded from a save does not move its units exactly as the same game
+// left running, and a replay started from a save is only repeatable
+// when played from that save again. -savecheck compares the saved data
+// only, so it does not catch this. All players of a multiplayer game
+// load together, so they stay in sync.
+//
+class SeekPathCache
+{
+public:
+	SeekPathCacheEntry	entry_array[SEEK_PATH_CACHE_SIZE];
+
+	uint32_t*		cell_stamp_array;			// the change_stamp of the last change of each cell
+	int				cell_width, cell_height;
+	uint32_t			change_stamp;
+
+	unsigned long	hit_count;
+	unsigned long	miss_count;
+	unsigned long	expire_count;				// paths dropped because of map changes
+
+public:
+	SeekPathCache();
+	~SeekPathCache()		{ deinit(); }
+
+	void			init(int maxXLoc, int maxYLoc);
+	void			deinit();
+	void			clear();
+
+	void			loc_changed(int xLoc, int yLoc);
+
+	ResultNode*	get_path(int startXLoc, int startYLoc, int destXLoc, int destYLoc, char mobileType,
+							short searchMode, short miscNo, char nationRecno, int& nodeCount, short& pathDist);
+	void			add_path(int startXLoc, int startYLoc, int destXLoc, int destYLoc, char mobileType,
+							short searchMode, short miscNo, char nationRecno, ResultNode* nodeArray, int nodeCount, short pathDist);
+
+	static int	can_cache(char mobileType, short searchMode, short numOfPath);
+
+	void			draw_profile();
+
+private:
+	SeekPathCacheEntry* get_entry(int startXLoc, int startYLoc, int destXLoc, int destYLoc, char mobileType, short searchMode, short miscNo);
+	int			is_path_valid(SeekPathCacheEntry* entryPtr);
+	void			free_entry(SeekPathCacheEntry* entryPtr);
+};
+
+extern SeekPathCache seek_path_cache;
+
+#endif
@@ -0,0 +1,105 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : OSPRLOAD.H
+//Description : Background loading of the sprite bitmap files
+
+#ifndef __OSPRLOAD_H
+#define __OSPRLOAD_H
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#ifndef __FILEPATH_H
+#include <FilePath.h>
+#endif
+
+struct SpriteInfo;
+
+//-------- Define constant ---------//
+
+#define MAX_SPRITE_LOAD		16		// no. of sprite files queued or kept loaded at a time
+
+enum { SPRITE_LOAD_EMPTY=0,
+		 SPRITE_LOAD_QUEUED,
+		 SPRITE_LOAD_READING,
+		 SPRITE_LOAD_DONE,
+		 SPRITE_LOAD_FAILED };
+
+//------- Define struct SpriteLoadRequest -------//
+
+struct SpriteLoadRequest
+{
+	SpriteInfo*		sprite_info;
+	char				file_name[FilePath::MAX_FILE_PATH+1];
+	char				status;
+
+	char*				data_buf;				// allocated with mem_add() by the loading thread
+	int				data_size;
+
+	unsigned long	request_time;			// misc.get_time() when prefetch() was called
+	unsigned long	read_ms;					// the time it took to read the file
+};
+
+//------- Define class SpriteLoader -------//
+//
+// Reads the .SPR file of a sprite type in a background thread before it
+// is needed, when a unit of that type starts being built, trained or
+// invoked. SpriteInfo::load_bitmap_res() then takes the file from here
+// instead of reading it. If the file is still being read, the sprite is
+// not drawn until it is ready.
+//
+// Only files are read in the background. Game data is only changed by
+// the main thread, so multiplayer games stay in sync.
+//
+class SpriteLoader
+{
+public:
+	SpriteLoadRequest			request_array[MAX_SPRITE_LOAD];
+
+private:
+	std::thread					load_thread;
+	std::mutex					load_mutex;
+	std::condition_variable	load_cond;
+	bool							quit_flag;
+
+public:
+	SpriteLoader();
+	~SpriteLoader()		{ deinit(); }
+
+	void		deinit();
+
+	void		prefetch(int spriteId);
+	void		prefetch_unit(int unitId);
+
+	int		take(SpriteInfo* spriteInfo);
+	int		is_pending(SpriteInfo* spriteInfo);
+
+private:
+	SpriteLoadRequest* get_request(SpriteInfo* spriteInfo);
+	void		free_request(SpriteLoadRequest* requestPtr);
+	void		load_main();
+};
+
+extern SpriteLoader sprite_loader;
+
+#endif
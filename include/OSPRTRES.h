@@ -174,6 +174,8 @@ public:
 
 	void			 load_bitmap_res();
 	void			 free_bitmap_res();
+	int			 is_bitmap_ready();
+	void			 read_bitmap_file();
 
 	int			 is_loaded()		{ return loaded_count>0; }
 	SpriteInfo *get_sub_sprite(int i);
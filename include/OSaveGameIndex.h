@@ -0,0 +1,74 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OSaveGameIndex.h
+//Description : Cache of the savegame headers, kept on disk next to the
+//              savegames so that the load/save menus only need to open
+//              the files that were changed since the menu was last shown.
+
+#ifndef __OSAVEGAMEINDEX_H
+#define __OSAVEGAMEINDEX_H
+
+#include <functional>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <OSaveGameArray.h>
+
+//-------- Define class SaveGameIndex -----------//
+//
+// One index is kept per filename wildcard ("*.SAV", "*.SVM"). An entry is
+// reused as long as the size and modification time of its file are
+// unchanged, otherwise the header is read again with GameFile::read_header.
+//
+class SaveGameIndex
+{
+public:
+	~SaveGameIndex();
+
+	// Starts rescanning the savegames in the background, so that a menu opened later has the list ready.
+	void prefetch(const char* filenameWildcard);
+
+	// Enumerates all the savegames that match the wildcard pattern, calling callback for each savegame.
+	void enumerate(const char* filenameWildcard, const std::function<void (const SaveGame* saveGame)>& callback);
+
+	// Drops the entry of a savegame that has been written, renamed or deleted by the game.
+	void forget(const char* saveGameName);
+
+private:
+	std::vector<SaveGame>& get_list(const char* filenameWildcard);
+	void  write_index(const char* filenameWildcard, const std::vector<SaveGame>& saveGameList);
+	void  finish_prefetch();
+
+private:
+	std::map<std::string, std::vector<SaveGame> > list_map;	// by wildcard, loaded from the index file on first use
+
+	std::thread           scan_thread;
+	std::string           scan_wildcard;
+	std::vector<SaveGame> scan_list;
+	bool                  scan_changed;
+	bool                  scan_stale;		// a savegame was written while scanning, so the result cannot be used
+};
+
+extern SaveGameIndex save_game_index;
+
+#endif // !__OSAVEGAMEINDEX_H
@@ -27,6 +27,7 @@
 
 #include <functional>
 
+class File;
 class String;
 struct SaveGame;
 struct SaveGameInfo;
@@ -60,8 +61,14 @@ public:
 	// Loads the scenario whose full path is given by filePath. Returns 1, 0, or -1 for resp. success, recoverable failure, or failure.
 	static int load_scenario(const char* filePath);
 
+	// Save the current game into a memory file, e.g. for sending it. It is not added to the savegames.
+	static bool save_game_mem(File* filePtr);
+	// Loads the game saved into a memory file by save_game_mem() as the current game. Returns 1, 0, or -1 for resp. success, recoverable failure, or failure.
+	static int load_game_mem(File* filePtr, SaveGameInfo* /*out*/ saveGameInfo);
+
 private:
 	static int load_game_from_file(const char* filePath, SaveGameInfo* /*out*/ saveGameInfo);
+	static int run_load(const std::function<int ()>& loadFunc);
 };
 
 #endif // !__OSAVEGAMEPROVIDER_H
@@ -0,0 +1,94 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : OTEXTCAC.H
+//Description : Cache of the widths and drawn images of short texts
+
+#ifndef __OTEXTCAC_H
+#define __OTEXTCAC_H
+
+#include <stdint.h>
+
+class Font;
+
+//-------- Define constant ---------//
+
+#define TEXT_CACHE_SIZE				512	// no. of texts kept, must be a power of 2
+#define MAX_TEXT_CACHE_LEN			63		// longer texts are not cached
+
+//------- Define struct TextCacheEntry -------//
+
+struct TextCacheEntry
+{
+	Font*		font_ptr;							// NULL if the entry is not used
+	char		text[MAX_TEXT_CACHE_LEN+1];	// the text before the locale conversion
+
+	short		text_width;							// -1 if it has not been calculated
+	short		line_count;
+
+	char		span_state;							// SPAN_NONE, SPAN_READY or SPAN_CANNOT
+	char		put_count;							// no. of times drawn before the image is made
+	short		span_need_width;					// the text is only drawn at once if it has this much room
+	short		span_last_x;						// the x offset of the last pixel, as returned by Font::put()
+	char*		span_bitmap;						// the whole text drawn for IMGbltTrans()
+};
+
+//------- Define class TextCache -------//
+//
+// Most texts on the screen are the same labels drawn over and over.
+// The first time a text is measured with a font, its width is kept.
+// The second time it is drawn, an image of the whole text is kept, so
+// later the text is not converted and laid out character by character
+// again. Texts drawn only once, like changing numbers, are not worth
+// an image.
+//
+// The glyphs of a font are already packed in Font::font_bitmap_buf.
+// Texts with @COL nation color bars are measured but not kept as an
+// image.
+//
+class TextCache
+{
+public:
+	enum { SPAN_NONE=0, SPAN_READY, SPAN_CANNOT };
+
+	TextCacheEntry	entry_array[TEXT_CACHE_SIZE];
+
+	unsigned long	hit_count;
+	unsigned long	miss_count;
+
+public:
+	TextCache();
+	~TextCache()		{ deinit(); }
+
+	void				deinit();
+	void				clear_font(Font* fontPtr);
+
+	TextCacheEntry* get_entry(Font* fontPtr, const char* textPtr);
+
+	void				draw_profile();
+
+private:
+	void				free_entry(TextCacheEntry* entryPtr);
+};
+
+extern TextCache text_cache;
+
+#endif
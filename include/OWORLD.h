@@ -36,6 +36,14 @@
 #include <OUNITRES.h>
 #endif
 
+#ifndef __OPASSMAP_H
+#include <OPASSMAP.h>
+#endif
+
+#ifndef __OREACH_H
+#include <OREACH.h>
+#endif
+
 //----------- Define constant ------------//
 
 #define EXPLORE_RANGE   10
@@ -52,6 +60,11 @@
 #define MIN_MOUNTAIN_HEIGHT 242
 #define MIN_ICE_HEIGHT 		 252
 
+//------- define unit blocks --------//
+
+enum { UNIT_BLOCK_SHIFT = 3,						// the map is divided into blocks of 8x8 locations
+		 UNIT_BLOCK_SIZE  = 1 << UNIT_BLOCK_SHIFT };
+
 //---------------- Define class World -------------//
 
 class Weather;
@@ -72,6 +85,16 @@ public:
 	int			 plant_count;
 	int			 plant_limit;
 
+	short*		 unit_block_count;		// the no. of land and sea units in each unit block, not saved but counted in assign_map()
+	int			 unit_block_width;		// the no. of unit blocks in a row
+
+	PassMap		 pass_map;					// PASS_LAND and PASS_SEA of each location, not saved but built in assign_map()
+	PassMap		 occupy_map;				// OCCUPY_GROUND and OCCUPY_AIR of each location, kept up to date by set_unit_recno()
+	PassMap		 build_map;					// BUILD_NO_SITE and BUILD_POWER_ON of each location
+	ReachMap		 reach_map;					// the connected areas of pass_map
+	int			 pass_change_count;		// incremented whenever pass_map changes, for telling whether things calculated from it are out of date
+	int			 power_change_count;		// incremented whenever the power_nation_recno of a location changes, likewise
+
 	//--------- static member vars --------------//
 
 	static short view_top_x, view_top_y;		// the view window in the scene, they are relative coordinations on the entire virtual surface.
@@ -118,6 +141,18 @@ public:
 	short		get_unit_recno(int xLoc,int yLoc, int mobileType);
 	void 		set_unit_recno(int xLoc, int yLoc, int mobileType, int newCargoRecno);
 
+	int		block_unit_count(int xLoc, int yLoc)
+				{ return unit_block_count[(yLoc>>UNIT_BLOCK_SHIFT)*unit_block_width + (xLoc>>UNIT_BLOCK_SHIFT)]; }
+	int		area_unit_count(int xLoc1, int yLoc1, int xLoc2, int yLoc2);
+
+	void		update_pass_maps(Location* locPtr);
+	int		can_move(int xLoc, int yLoc, int mobileType);
+	int		can_build(int xLoc, int yLoc, int teraMask);
+
+	int		can_reach(int srcXLoc1, int srcYLoc1, int srcXLoc2, int srcYLoc2,
+							 int destXLoc1, int destYLoc1, int destXLoc2, int destYLoc2, int mobileType);
+	int		locate_reachable(int& xLoc, int& yLoc, int srcXLoc, int srcYLoc, int maxRange);
+
 	int 		distance_rating(int xLoc1, int yLoc1, int xLoc2, int yLoc2);
 
 	void		unveil(int xLoc1, int yLoc1, int xLoc2, int yLoc2);
@@ -202,6 +237,9 @@ private:
 	int	  	detect_scroll();
 	// int		detect_firm_town();
 
+	void		count_block_units();
+	void		build_pass_maps();
+
 	//--------- ambient sound functions --------//
 
 	void		process_ambient_sound();
@@ -259,15 +297,79 @@ inline short World::get_unit_recno(int xLoc, int yLoc, int mobileType)
 inline void World::set_unit_recno(int xLoc,int yLoc, int mobileType, int newCargoRecno)
 {
 	if( mobileType==UNIT_AIR )
-		loc_matrix[MAX_WORLD_X_LOC*yLoc+xLoc].air_cargo_recno = newCargoRecno;
+	{
+		int locOffset = MAX_WORLD_X_LOC*yLoc + xLoc;
+
+		loc_matrix[locOffset].air_cargo_recno = newCargoRecno;
+
+		occupy_map.set( locOffset, (occupy_map.get(locOffset) & ~OCCUPY_AIR) | (newCargoRecno ? OCCUPY_AIR : 0) );
+	}
 	else
-		loc_matrix[MAX_WORLD_X_LOC*yLoc+xLoc].cargo_recno = newCargoRecno;
+	{
+		Location* locPtr = loc_matrix + MAX_WORLD_X_LOC*yLoc + xLoc;
+
+		if( !locPtr->cargo_recno != !newCargoRecno )		// a unit enters or leaves, not one replacing another
+		{
+			short& blockCount = unit_block_count[(yLoc>>UNIT_BLOCK_SHIFT)*unit_block_width + (xLoc>>UNIT_BLOCK_SHIFT)];
+
+			blockCount += newCargoRecno ? 1 : -1;
+
+			err_when( blockCount < 0 );
+
+			int locOffset = MAX_WORLD_X_LOC*yLoc + xLoc;
+
+			occupy_map.set( locOffset, (occupy_map.get(locOffset) & ~OCCUPY_GROUND) | (newCargoRecno ? OCCUPY_GROUND : 0) );
+		}
+
+		locPtr->cargo_recno = newCargoRecno;
+	}
 
 	err_when(mobileType!=UNIT_AIR && loc_matrix[MAX_WORLD_X_LOC*yLoc+xLoc].is_firm());
 }
 //--------- End of function World::set_unit_recno -------//
 
 
+//-------- Begin of function World::can_move -------//
+//
+// Same as Location::can_move(), but read from the pass maps.
+//
+inline int World::can_move(int xLoc, int yLoc, int mobileType)
+{
+	int locOffset = MAX_WORLD_X_LOC*yLoc + xLoc;
+
+	switch( mobileType )
+	{
+		case UNIT_LAND:
+			return (pass_map.get(locOffset) & PASS_LAND) && !(occupy_map.get(locOffset) & OCCUPY_GROUND);
+
+		case UNIT_SEA:
+			return (pass_map.get(locOffset) & PASS_SEA) && !(occupy_map.get(locOffset) & OCCUPY_GROUND);
+
+		case UNIT_AIR:
+			return !(occupy_map.get(locOffset) & OCCUPY_AIR);
+	}
+
+	return 0;
+}
+//--------- End of function World::can_move -------//
+
+
+//-------- Begin of function World::can_build -------//
+//
+// Same as Location::can_build_firm(), but read from the pass maps.
+//
+// <int> teraMask = PASS_LAND, PASS_SEA or both
+//
+inline int World::can_build(int xLoc, int yLoc, int teraMask)
+{
+	int locOffset = MAX_WORLD_X_LOC*yLoc + xLoc;
+
+	return (pass_map.get(locOffset) & teraMask) && !(occupy_map.get(locOffset) & OCCUPY_GROUND) &&
+			 (build_map.get(locOffset) & BUILD_POWER_ON);
+}
+//--------- End of function World::can_build -------//
+
+
 //--------- Begin of function World::distance_rating --------//
 //
 inline int World::distance_rating(int xLoc1, int yLoc1, int xLoc2, int yLoc2)
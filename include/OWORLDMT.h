@@ -28,8 +28,8 @@
 #include <OMATRIX.h>
 #endif
 
-#ifndef __ODYNARR_H
-#include <ODYNARR.h>
+#ifndef __ODYNARRT_H
+#include <ODYNARRT.h>
 #endif
 
 //-------- World matrix size ------------//
@@ -93,6 +93,10 @@ public:
 	char	map_mode;
 	char	power_mode;		// 1-also display power regions on the zoom map, 0-only display power regions on the mini map
 
+protected:
+	char*	terrain_layer;			// shaded terrain colour of each location, terrain does not change once the map is made
+	char	terrain_layer_valid;
+
 public:
 	MapMatrix();
    ~MapMatrix();
@@ -106,22 +110,36 @@ public:
 	void toggle_map_mode(int modeId);
 	void cycle_map_mode();
 
+	void clear_terrain_layer()		{ terrain_layer_valid = 0; }
+	char get_loc_color(int xLoc, int yLoc);
+
 protected:
 	void draw_map();
+	void build_terrain_layer();
 	int  detect_area();
 
 	void disp_mode_button(int putFront=0);
 };
 
+//---------- Define struct DisplaySort ----------//
+
+struct DisplaySort
+{
+	char	object_type;
+	short object_recno;
+	short object_y2;
+	short x_loc, y_loc;
+};
+
 //-------- Define class ZoomMatrix -------//
 
 class ZoomMatrix : public Matrix
 {
 public:
-	DynArray land_disp_sort_array;     // an array for displaying objects in a sorted order
-	DynArray air_disp_sort_array;
-	DynArray land_top_disp_sort_array;
-	DynArray land_bottom_disp_sort_array;
+	DynArrayT<DisplaySort> land_disp_sort_array;     // an array for displaying objects in a sorted order
+	DynArrayT<DisplaySort> air_disp_sort_array;
+	DynArrayT<DisplaySort> land_top_disp_sort_array;
+	DynArrayT<DisplaySort> land_bottom_disp_sort_array;
 
 	int	init_rain;
 	int	rain_channel_id;
@@ -149,7 +167,7 @@ public:
 
 protected:
 	void draw_objects();
-	void draw_objects_now(DynArray* unitArray, int = 0);
+	void draw_objects_now(DynArrayT<DisplaySort>* unitArray, int = 0);
 
 	void draw_weather_effects();
 
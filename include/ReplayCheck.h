@@ -0,0 +1,114 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : ReplayCheck.h
+//Description : Checking the simulation results and speed of a replay
+
+#ifndef __REPLAYCHECK_H
+#define __REPLAYCHECK_H
+
+#include <chrono>
+#include <stdint.h>
+#include <vector>
+
+//-------- Define class ReplayCheck --------//
+//
+// Started with the -replay command line option. The replay is played
+// at the fastest speed whatever speed was recorded, headless with
+// -noif. The object checksums
+// taken by CrcStore during the replay are compared with those stored
+// in the checksum file by an earlier run, and the time taken is
+// compared with the time stored there. The results are written to a
+// JSON report and returned as the exit code of the program.
+//
+// tools/rplcheck, or make check-replays, checks all replays in a
+// directory this way.
+//
+class ReplayCheck
+{
+public:
+	enum {
+		STEP_UNIT,
+		STEP_FIRM,
+		STEP_TOWN,
+		STEP_NATION,
+		STEP_BULLET,
+		STEP_WORLD,
+		STEP_OTHER,
+		STEP_COUNT,
+	};
+
+	enum {
+		RESULT_PASS = 0,
+		RESULT_MISMATCH,
+		RESULT_SLOW,
+		RESULT_ERROR,
+	};
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	int active;
+	const char *crc_path;
+	const char *report_path;
+	int max_slowdown;				// in percent, -1 if the time is not checked
+
+	int has_golden;				// 1 if the checksum file has been read, -1 if it cannot be read
+	long golden_time_ms;
+	std::vector<uint32_t> golden_frame_array;
+	std::vector<uint32_t> golden_crc_array;
+
+	std::vector<uint32_t> frame_array;
+	std::vector<uint32_t> crc_array;
+	long mismatch_frame;			// -1 if no mismatch yet
+
+	long frame_count;
+	Clock::time_point start_time;
+	Clock::time_point step_time;
+	double step_ms_array[STEP_COUNT];
+
+public:
+	ReplayCheck();
+	~ReplayCheck();
+
+	void init(const char *crcPath, const char *reportPath, int maxSlowdown);
+	int finish(const char *replayPath, int replayLoaded);
+
+	int is_active() { return active; }
+
+	void begin_frame() { if( active ) begin_frame_time(); }
+	void end_step(int stepId) { if( active ) add_step_time(stepId); }
+	void add_crc(uint32_t frameNo);
+
+private:
+	void begin_frame_time();
+	void add_step_time(int stepId);
+
+	int read_golden();
+	void write_golden(long timeMs);
+	void write_report(const char *replayPath, int result, long timeMs);
+};
+
+//-----------------------------------------------//
+
+extern ReplayCheck replay_check;
+
+#endif
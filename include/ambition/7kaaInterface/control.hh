@@ -40,6 +40,13 @@ void delayFrame(
 void displayNews(
 );
 
+/**
+ * @return The number of entities in the Ambition entity repository, for the
+ * memory accounting.
+ */
+unsigned long long int entityCount(
+);
+
 void pasteFromClipboard(
   char* destination,
   const unsigned int maximumSize
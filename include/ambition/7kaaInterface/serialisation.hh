@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <string>
 
 
@@ -35,10 +36,20 @@ void loadGame(
   const long int startingPosition
 );
 
+/** Loads from a game saved in memory, from where 7kaa stopped reading. */
+void loadGame(
+  std::istream& saveFile
+);
+
 void saveGame(
   const std::string filename
 );
 
+/** Appends to a game saved in memory. */
+void saveGame(
+  std::ostream& saveFile
+);
+
 } // namespace _7kaaAmbitionInterface::Serialisation
 
 #ifndef _AMBITION_IMPLEMENTATION
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <map>
 #include <memory>
 #include <type_traits>
@@ -76,6 +77,9 @@ public:
     return entity;
   }
 
+  std::size_t recordCount(
+  ) const;
+
   void reset(
   );
 
@@ -86,7 +90,7 @@ private:
   static const auto STARTING_RECORD_NUMBER = 1;
 
   friend void write(
-    const std::string filename
+    std::ostream& saveFile
   );
 
   struct Record;
@@ -26,6 +26,7 @@
 #pragma once
 
 #include <boost/serialization/version.hpp>
+#include <iosfwd>
 #include <string>
 
 
@@ -46,10 +47,18 @@ void read(
   const long startingPosition
 );
 
+void read(
+  std::istream& saveFile
+);
+
 void write(
   const std::string filename
 );
 
+void write(
+  std::ostream& saveFile
+);
+
 } // namespace Ambition
 
 BOOST_CLASS_VERSION(Ambition::SavefileInformation, 0)
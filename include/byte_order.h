@@ -0,0 +1,59 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BYTE_ORDER_H
+#define BYTE_ORDER_H
+
+#include <algorithm>
+#include <string.h>
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define HOST_BIG_ENDIAN 1
+#else
+#define HOST_BIG_ENDIAN 0
+#endif
+
+/* Stores a value as little-endian bytes */
+template <typename T>
+inline void store_le(unsigned char *p, T val)
+{
+   memcpy(p, &val, sizeof(T));
+#if HOST_BIG_ENDIAN
+   std::reverse(p, p + sizeof(T));
+#endif
+}
+
+/* Loads a value from little-endian bytes */
+template <typename T>
+inline T load_le(const unsigned char *p)
+{
+   T val;
+#if HOST_BIG_ENDIAN
+   unsigned char bytes[sizeof(T)];
+   std::reverse_copy(p, p + sizeof(T), bytes);
+   memcpy(&val, bytes, sizeof(T));
+#else
+   memcpy(&val, p, sizeof(T));
+#endif
+   return val;
+}
+
+/* vim: set ts=8 sw=3: */
+#endif
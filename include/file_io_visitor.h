@@ -159,7 +159,7 @@ namespace FileIOVisitor
       v.init(&w);
       visit_obj(&v, obj);
 
-      return w.good();
+      return w.flush();
    }
 
    template <typename T>
@@ -174,6 +174,7 @@ namespace FileIOVisitor
 	 return false;
 
       r.check_record_size(expected_rec_size);
+      r.prefetch(expected_rec_size);
       v.init(&r);
       visit_obj(&v, obj);
 
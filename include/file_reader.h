@@ -20,24 +20,41 @@
 #ifndef FILE_READER_H
 #define FILE_READER_H
 
+#include <type_traits>
+
+#include <byte_order.h>
 #include <file_input_stream.h>
 
+/*
+ * prefetch() reads a record into a buffer in one go, values are then taken
+ * from the buffer. Reading past the prefetched bytes falls back to reading
+ * the file, and the bytes not used are given back by deinit(), so the file
+ * position is always the same as without prefetching.
+ */
 class FileReader
 {
 protected:
+   enum {BUFFER_SIZE = 0x1000};
+
    FileInputStream is;
    File::FileType original_type;
    File *file;
    bool ok;
 
+   unsigned char buffer[BUFFER_SIZE];
+   size_t buffer_len;
+   size_t buffer_pos;
+
 public:
    FileReader();
    ~FileReader();
    bool init(File *file);
    void deinit();
    bool good() const;
+   bool prefetch(size_t len);
    bool skip(size_t len);
    bool check_record_size(uint16_t expected_size);
+   bool read_bytes(void *data, size_t len);
 
    template <typename FileT, typename MemT>
    bool read(MemT *v)
@@ -47,7 +64,14 @@ public:
       if (!this->ok)
 	 return false;
 
-      if (read_le(&this->is, &val))
+      if (this->buffer_pos + sizeof(FileT) <= this->buffer_len)
+      {
+	 *v = load_le<FileT>(this->buffer + this->buffer_pos);
+	 this->buffer_pos += sizeof(FileT);
+	 return true;
+      }
+
+      if (this->drop_buffer() && read_le(&this->is, &val))
 	 *v = val;
       else
 	 this->ok = false;
@@ -74,6 +98,10 @@ public:
    template <typename FileT, typename MemT>
    bool read_array(MemT *array, size_t len)
    {
+      /* same layout in memory and in the file, copy it as a whole */
+      if (!HOST_BIG_ENDIAN && std::is_same<FileT, MemT>::value)
+	 return this->read_bytes(array, sizeof(FileT) * len);
+
       for (size_t n = 0; n < len; n++)
       {
 	 if (!this->read<FileT>(&array[n]))
@@ -82,6 +110,9 @@ public:
 
       return this->ok;
    }
+
+protected:
+   bool drop_buffer();
 };
 
 /* vim: set ts=8 sw=3: */
@@ -20,24 +20,39 @@
 #ifndef FILE_WRITER_H
 #define FILE_WRITER_H
 
+#include <type_traits>
+
+#include <byte_order.h>
 #include <file_output_stream.h>
 
+/*
+ * Values are collected in a buffer and written to the file in one go by
+ * flush() or deinit(), so that a record costs one file write rather than
+ * one per byte.
+ */
 class FileWriter
 {
 protected:
+   enum {BUFFER_SIZE = 0x1000};
+
    FileOutputStream os;
    File::FileType original_type;
    File *file;
    bool ok;
 
+   unsigned char buffer[BUFFER_SIZE];
+   size_t buffer_len;
+
 public:
    FileWriter();
    ~FileWriter();
    bool init(File *file);
    void deinit();
    bool good() const;
+   bool flush();
    bool skip(size_t len);
    bool write_record_size(uint16_t size);
+   bool write_bytes(const void *data, size_t len);
 
    template <typename FileT, typename MemT>
    bool write(MemT val)
@@ -45,10 +60,13 @@ public:
       if (!this->ok)
 	 return false;
 
-      if (!write_le<FileT>(&this->os, val))
-	 this->ok = false;
+      if (this->buffer_len + sizeof(FileT) > BUFFER_SIZE && !this->flush())
+	 return false;
 
-      return this->ok;
+      store_le<FileT>(this->buffer + this->buffer_len, val);
+      this->buffer_len += sizeof(FileT);
+
+      return true;
    }
 
    template <typename T>
@@ -67,6 +85,10 @@ public:
    template <typename FileT, typename MemT>
    bool write_array(const MemT *array, size_t len)
    {
+      /* same layout in memory and in the file, copy it as a whole */
+      if (!HOST_BIG_ENDIAN && std::is_same<FileT, MemT>::value)
+	 return this->write_bytes(array, sizeof(FileT) * len);
+
       for (size_t n = 0; n < len; n++)
       {
 	 if (!this->write<FileT>(array[n]))
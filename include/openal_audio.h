@@ -22,7 +22,10 @@
 #ifndef OPENAL_AUDIO_H
 #define OPENAL_AUDIO_H
 
+#include <atomic>
 #include <map>
+#include <mutex>
+#include <thread>
 
 #include OPENAL_AL_H
 #include OPENAL_ALC_H
@@ -84,6 +87,8 @@ private:
 	enum {DESIRED_LOOP_SOURCES_COUNT = 4, DESIRED_LONG_SOURCES_COUNT = 4,
 		DEFAULT_NORMAL_SOURCES_COUNT = 24, MINIMAL_SOURCES_REQUIRED = 12};
 
+	enum {STREAM_INTERVAL_MSEC = 10};
+
 public:
 	OpenALAudio();
 	~OpenALAudio();
@@ -91,7 +96,7 @@ public:
 	int	init();
 	void deinit();
 
-	void yield(); // called by sys every some time
+	void yield(); // called by sys every some time, streaming is done by stream_thread
 
 	int	play_mid(char*);
 
@@ -145,6 +150,16 @@ private:
 
 	StreamMap streams;
 
+	/*
+	 * stream_thread refills the buffers of all streams every
+	 * STREAM_INTERVAL_MSEC, so that sounds keep playing while a frame
+	 * takes long. stream_lock guards streams and the source counts below,
+	 * all public functions touching them take it.
+	 */
+	std::thread stream_thread;
+	std::recursive_mutex stream_lock;
+	std::atomic<bool> stream_thread_quit;
+
 	int normal_sources; // Number of normal waves in stream
 	int long_sources;
 	int loop_sources;
@@ -170,6 +185,9 @@ private:
 	int stop_any_wav(int);
 
 	int play_long_wav(InputStream *, const DsVolume &);
+
+	void stream_all();
+	void stream_thread_main();
 };
 
 typedef OpenALAudio Audio;
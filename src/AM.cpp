@@ -39,16 +39,21 @@
 #include <ODATE.h>
 #include <OFIRM.h>
 #include <OFLAME.h>
+#include <OFLOWFLD.h>
 #include <OFONT.h>
 #include <OGAME.h>
 #include <OGAMESET.h>
+#include <OFILEPRE.h>
 #include <OSaveGameArray.h>
+#include <OSaveGameIndex.h>
 #include <OGAMHALL.h>
+#include <OGFILE.h>
 #include <OGODRES.h>
 #include <OHELP.h>
 #include <OHILLRES.h>
 #include <OIMGRES.h>
 #include <OINFO.h>
+#include <OINFOFLD.h>
 #include <OMONSRES.h>
 #include <OMOUSE.h>
 #include <OMOUSECR.h>
@@ -59,16 +64,22 @@
 #include <ORACERES.h>
 #include <OREBEL.h>
 #include <OREMOTE.h>
+#include <ORENDSNP.h>
+#include <ORESBAKE.h>
 #include <OSPATH.h>
+#include <OSPATHC.h>
 #include <OSITE.h>
 #include <OSPREUSE.h>
+#include <OSPRLOAD.h>
 #include <OSPY.h>
 #include <OSYS.h>
 #include <OTALKRES.h>
 #include <OTECHRES.h>
 #include <OTERRAIN.h>
+#include <OTEXTCAC.h>
 #include <OTOWN.h>
 #include <OTownNetwork.h>
+#include <ONATVIEW.h>
 #include <OUNIT.h>
 #include <OVGA.h>
 #include <vga_util.h>
@@ -102,6 +113,8 @@
 //#### end alex 3/10 ####//
 #include <OFIRMDIE.h>
 #include <OCRC_STO.h>
+#include <OFLTREC.h>
+#include <OMPRESYN.h>
 // ###### begin Gilbert 23/10 #######//
 #include <OOPTMENU.h>
 #include <OINGMENU.h>
@@ -111,6 +124,7 @@
 #include <LocaleRes.h>
 #include <PlayerStats.h>
 #include <ConfigAdv.h>
+#include <ReplayCheck.h>
 
 //------- define game version constant --------//
 
@@ -142,9 +156,13 @@ WebService        ws;
 #endif
 Sys               sys;
 SeekPath          seek_path;
+SeekPathCache     seek_path_cache;
 SeekPathReuse     seek_path_reuse;
+SpriteLoader      sprite_loader;
+FlowFieldArray    flow_field_array;
 Flame             flame[FLAME_GROW_STEP];
 Remote            remote;
+RenderSnapshot    render_snapshot;
 ErrorControl      ec_remote;
 AnimLine          anim_line;
 SECtrl            se_ctrl(&audio);
@@ -159,6 +177,7 @@ GroupSelect			group_select;
 
 //------- Resource class ----------//
 
+TextCache         text_cache;		// before the fonts as they clear their texts from it when destructed
 Font              font_san, font_std, font_small, font_mid, font_news;
 Font              font_hitpoint, font_bible, font_bard;
 
@@ -204,6 +223,7 @@ BulletArray       bullet_array(100);
 SiteArray         site_array;
 TownArray         town_array;
 TownNetworkArray  town_network_array;
+NationViewArray   nation_view_array;
 NationArray       nation_array;
 FirmArray         firm_array;
 FirmDieArray	  firm_die_array;
@@ -218,20 +238,26 @@ RegionArray       region_array;
 NewsArray         news_array;
 WarPointArray     war_point_array;
 CrcStore				crc_store;
+FlightRecorder		flight_recorder;
+MpResync				mp_resync;
 
 //--------- Game Surface class ------------//
 
 Info              info;
+InfoFieldCache    info_field_cache;
 Weather           weather, weather_forecast[MAX_WEATHER_FORECAST];
 MagicWeather      magic_weather;
 Config            config;
 Game              game;
 GameSet           game_set;         // no constructor
+ResourceBake      res_bake;
+FilePreload       file_preload;
 Battle            battle;
 Power             power;
 World             world;
 char              scenario_file_name[FilePath::MAX_FILE_PATH+1];
 SaveGameArray     save_game_array;
+SaveGameIndex     save_game_index;
 nsPlayerStats::PlayerStats playerStats;
 HallOfFame        hall_of_fame;
 // ###### begin Gilbert 23/10 #######//
@@ -240,6 +266,7 @@ InGameMenu			in_game_menu;
 // ###### end Gilbert 23/10 #######//
 CmdLine           cmd_line;
 ConfigAdv         config_adv;
+ReplayCheck       replay_check;
 
 //----------- Global Variables -----------//
 
@@ -363,6 +390,8 @@ int main(int argc, char **argv)
 
 	Ambition::Control::displayNews();
 
+	int exitCode = 0;
+
 	switch( cmd_line.startup_mode )
 	{
 	case STARTUP_NORMAL:
@@ -388,6 +417,25 @@ int main(int argc, char **argv)
 		battle.run(0);
 		game.deinit();
 		break;
+	case STARTUP_REPLAY:
+		config.help_mode = NO_HELP;
+		replay_check.init(cmd_line.replay_crc_path, cmd_line.replay_report_path, cmd_line.max_slowdown);
+		exitCode = replay_check.finish(cmd_line.replay_path, battle.run_replay(cmd_line.replay_path));
+		break;
+	case STARTUP_SAVE_CHECK:
+		switch( GameFile::check_round_trip(cmd_line.save_check_path) )
+		{
+		case 1:
+			exitCode = 0;
+			break;
+		case 0:
+			exitCode = 1;		// the bytes differ
+			break;
+		default:
+			exitCode = 2;		// cannot be loaded
+		}
+		game.deinit();
+		break;
 	default:
 		game.main_menu();
 		break;
@@ -397,7 +445,7 @@ int main(int argc, char **argv)
 
 	sys.deinit();
 
-	return 0;
+	return exitCode;
 }
 //---------- End of function main ----------//
 
@@ -37,6 +37,11 @@ CmdLine::CmdLine()
 	game_speed = -1;
 	startup_mode = STARTUP_NORMAL;
 	join_host = NULL;
+	replay_path = NULL;
+	replay_crc_path = NULL;
+	replay_report_path = NULL;
+	save_check_path = NULL;
+	max_slowdown = -1;
 }
 
 CmdLine::~CmdLine()
@@ -75,6 +80,21 @@ static int set_startup_mode(StartupMode mode)
 //   Set the name you wish to be known as.
 // -speed <game speed>
 //   Set the initial game speed (not for multiplayer)
+// -replay <replay file>
+//   Play the replay at the fastest speed and exit, see ReplayCheck. Add
+//   -noif to play it without the interface.
+// -checksum <checksum file>
+//   Compare the replay with the checksum file, or write it if it does
+//   not exist
+// -report <report file>
+//   Write the results of the replay as JSON
+// -maxslowdown <percent>
+//   Fail if the replay is slower than the time in the checksum file by
+//   more than this percentage
+// -savecheck <saved game>
+//   Load the saved game, write it again and exit, with exit code 0 if
+//   the game data is written the same, see GameFile::check_round_trip().
+//   Add -noif to leave out the interface.
 int CmdLine::init(int argc, char **argv)
 {
 	const char *lobbyJoinOption = "-join";
@@ -86,6 +106,11 @@ int CmdLine::init(int argc, char **argv)
 	const char *rndOption = "-rnd";
 	const char *speedOption = "-speed";
 	const char *windowOption = "-win";
+	const char *replayOption = "-replay";
+	const char *checksumOption = "-checksum";
+	const char *reportOption = "-report";
+	const char *maxSlowdownOption = "-maxslowdown";
+	const char *saveCheckOption = "-savecheck";
 	for( int i = 1; i < argc; i++ )
 	{
 		if( !strcmp(argv[i], lobbyJoinOption) )
@@ -116,7 +141,9 @@ int CmdLine::init(int argc, char **argv)
 		}
 		else if( !strcmp(argv[i], noIfOption) )
 		{
-			if( cmd_line.startup_mode == STARTUP_DEMO )
+			if( cmd_line.startup_mode == STARTUP_DEMO ||
+				cmd_line.startup_mode == STARTUP_REPLAY ||
+				cmd_line.startup_mode == STARTUP_SAVE_CHECK )
 			{
 				enable_audio = 0;
 				enable_if = 0;
@@ -138,6 +165,38 @@ int CmdLine::init(int argc, char **argv)
 		{
 			config_adv.vga_full_screen = 0;
 		}
+		else if( !strcmp(argv[i], replayOption) )
+		{
+			if( !have_arg(i, argc, replayOption) )
+				return 0;
+			set_startup_mode(STARTUP_REPLAY);
+			replay_path = argv[++i];
+		}
+		else if( !strcmp(argv[i], checksumOption) )
+		{
+			if( !have_arg(i, argc, checksumOption) )
+				return 0;
+			replay_crc_path = argv[++i];
+		}
+		else if( !strcmp(argv[i], reportOption) )
+		{
+			if( !have_arg(i, argc, reportOption) )
+				return 0;
+			replay_report_path = argv[++i];
+		}
+		else if( !strcmp(argv[i], maxSlowdownOption) )
+		{
+			if( !have_arg(i, argc, maxSlowdownOption) )
+				return 0;
+			max_slowdown = atoi(argv[++i]);
+		}
+		else if( !strcmp(argv[i], saveCheckOption) )
+		{
+			if( !have_arg(i, argc, saveCheckOption) )
+				return 0;
+			set_startup_mode(STARTUP_SAVE_CHECK);
+			save_check_path = argv[++i];
+		}
 	}
 	return 1;
 }
@@ -35,6 +35,7 @@
 //------ Declare static functions --------//
 
 static int get_target_nation_recno(int targetXLoc, int targetYLoc);
+static void get_target_area(int targetXLoc, int targetYLoc, int& xLoc1, int& yLoc1, int& xLoc2, int& yLoc2);
 static int sort_attack_camp_function( const void *a, const void *b );
 
 
@@ -117,6 +118,9 @@ int Nation::ai_attack_target(int targetXLoc, int targetYLoc, int targetCombatLev
 	FirmCamp* firmCamp;
 	int   i, j;
 	int   targetRegionId = world.get_loc(targetXLoc, targetYLoc)->region_id;
+	int   targetXLoc1, targetYLoc1, targetXLoc2, targetYLoc2;
+
+	get_target_area(targetXLoc, targetYLoc, targetXLoc1, targetYLoc1, targetXLoc2, targetYLoc2);
 
 	err_when( targetXLoc < 0 || targetXLoc >= MAX_WORLD_X_LOC );
 	err_when( targetYLoc < 0 || targetYLoc >= MAX_WORLD_Y_LOC );
@@ -213,6 +217,10 @@ int Nation::ai_attack_target(int targetXLoc, int targetYLoc, int targetCombatLev
 		if( firmCamp->region_id != targetRegionId )
 			continue;
 
+		if( !world.can_reach(firmCamp->loc_x1, firmCamp->loc_y1, firmCamp->loc_x2, firmCamp->loc_y2,
+									targetXLoc1, targetYLoc1, targetXLoc2, targetYLoc2, UNIT_LAND) )		// walled in or cut off by buildings
+			continue;
+
 		if( !firmCamp->overseer_recno || !firmCamp->worker_count )
 			continue;
 
@@ -348,7 +356,9 @@ int Nation::ai_attack_target(int targetXLoc, int targetYLoc, int targetCombatLev
 
 					totalCombatLevel += firmCamp->total_combat_level();
 
-					if( townCampCount < MAX_SUITABLE_TOWN_CAMP )
+					if( townCampCount < MAX_SUITABLE_TOWN_CAMP &&
+						 world.can_reach(firmCamp->loc_x1, firmCamp->loc_y1, firmCamp->loc_x2, firmCamp->loc_y2,
+											  targetXLoc1, targetYLoc1, targetXLoc2, targetYLoc2, UNIT_LAND) )
 					{
 						err_when( firmCamp->nation_recno != nation_recno );
 
@@ -495,6 +505,14 @@ int Nation::ai_attack_order_nearby_mobile(int targetXLoc, int targetYLoc, int ta
 	int		 targetRegionId = world.get_region_id(targetXLoc, targetYLoc);
 	Location* locPtr;
 
+	//--- the locations scanned are all within scanRange of the target ---//
+
+	if( !world.area_unit_count( MAX(0, targetXLoc-scanRange), MAX(0, targetYLoc-scanRange),
+		 MIN(MAX_WORLD_X_LOC-1, targetXLoc+scanRange), MIN(MAX_WORLD_Y_LOC-1, targetYLoc+scanRange) ) )
+	{
+		return targetCombatLevel;
+	}
+
 	for( int i=2 ; i<scanRange*scanRange ; i++ )
 	{
 		misc.cal_move_around_a_point(i, scanRange, scanRange, xOffset, yOffset);
@@ -508,6 +526,9 @@ int Nation::ai_attack_order_nearby_mobile(int targetXLoc, int targetYLoc, int ta
 		yLoc = MAX(0, yLoc);
 		yLoc = MIN(MAX_WORLD_Y_LOC-1, yLoc);
 
+		if( !world.block_unit_count(xLoc, yLoc) )
+			continue;
+
 		locPtr = world.get_loc(xLoc, yLoc);
 
 		if( locPtr->region_id != targetRegionId )
@@ -790,6 +811,42 @@ static int get_target_nation_recno(int targetXLoc, int targetYLoc)
 //---------- End of static function get_target_nation_recno --------//
 
 
+//------ Begin of static function get_target_area ------//
+//
+// Return the area of the firm or town at the target location, or the
+// target location itself.
+//
+static void get_target_area(int targetXLoc, int targetYLoc, int& xLoc1, int& yLoc1, int& xLoc2, int& yLoc2)
+{
+	Location* locPtr = world.get_loc(targetXLoc, targetYLoc);
+
+	if( locPtr->is_firm() )
+	{
+		Firm* firmPtr = firm_array[locPtr->firm_recno()];
+
+		xLoc1 = firmPtr->loc_x1;
+		yLoc1 = firmPtr->loc_y1;
+		xLoc2 = firmPtr->loc_x2;
+		yLoc2 = firmPtr->loc_y2;
+	}
+	else if( locPtr->is_town() )
+	{
+		Town* townPtr = town_array[locPtr->town_recno()];
+
+		xLoc1 = townPtr->loc_x1;
+		yLoc1 = townPtr->loc_y1;
+		xLoc2 = townPtr->loc_x2;
+		yLoc2 = townPtr->loc_y2;
+	}
+	else
+	{
+		xLoc1 = xLoc2 = targetXLoc;
+		yLoc1 = yLoc2 = targetYLoc;
+	}
+}
+//---------- End of static function get_target_area --------//
+
+
 //------ Begin of function sort_attack_camp_function ------//
 //
 static int sort_attack_camp_function( const void *a, const void *b )
@@ -22,6 +22,7 @@
 //Description: AI - capturing AI towns
 
 #include <stdlib.h>
+#include <vector>
 #include <ALL.h>
 #include "OF_CAMP.h"
 #include "OF_MINE.h"
@@ -29,6 +30,7 @@
 #include <OCONFIG.h>
 #include <OUNIT.h>
 #include <ONATION.h>
+#include <OPARALEL.h>
 
 //--------- Begin of function Nation::think_capture_new_enemy_town --------//
 //
@@ -255,162 +257,209 @@ int Nation::attack_enemy_town_defense(Town* targetTown, int useAllCamp)
 // 2. Conquer land
 // 3. Defeat enemies
 //
+// The towns are rated on worker threads by rate_capture_enemy_town_target(),
+// the results are then compared in the same order as the towns used to be
+// scanned, so the same town is chosen as before.
+//
 Town* Nation::think_capture_enemy_town_target(Town* capturerTown)
 {
-	int   townRecno, curRating;
-	Town* targetTown, *bestTown=NULL;
-	Firm* firmPtr;
+	struct TargetRating
+	{
+		char result;				// result of rate_capture_enemy_town_target()
+		int  rating;
+		int  combat_level;
+	};
+
+	int   townCount = town_array.size();
 	int   ourMilitary = military_rank_rating();
-	Nation* ownNation = nation_array[nation_recno];
+	std::vector<TargetRating> ratingArray(townCount);
+
+	parallel_for( townCount, 16, [&](int i)
+	{
+		int townRecno = townCount-i;		// scan from the last town as before
+		TargetRating& targetRating = ratingArray[i];
+
+		if( town_array.is_deleted(townRecno) )
+			targetRating.result = 0;
+		else
+			targetRating.result = (char) rate_capture_enemy_town_target( capturerTown, town_array[townRecno],
+										  ourMilitary, targetRating.rating, targetRating.combat_level );
+	} );
+
+	//-------- compare the ratings ---------//
+
+	Town* bestTown=NULL;
 	int   bestRating = -1000;
-	int  	hasWar;
 	int   neededCombatLevel=0;
 
-	for( townRecno=town_array.size() ; townRecno>0 ; townRecno-- )
+	for( int i=0 ; i<townCount ; i++ )
 	{
-		if( town_array.is_deleted(townRecno) )
-			continue;
+		TargetRating& targetRating = ratingArray[i];
 
-		targetTown = town_array[townRecno];
+		if( targetRating.result == 2 )
+			return town_array[townCount-i];
 
-		if( targetTown->nation_recno == 0 ||
-			 targetTown->nation_recno == nation_recno )
+		if( targetRating.result == 1 && targetRating.rating > bestRating )
 		{
-			continue;
+			bestRating    = targetRating.rating;
+			bestTown      = town_array[townCount-i];
+			neededCombatLevel = targetRating.combat_level;
 		}
+	}
 
-		if( targetTown->region_id != capturerTown->region_id )
-			continue;
+	return bestTown;
+}
+//-------- End of function Nation::think_capture_enemy_town_target ------//
 
-		//----- if we have already built a camp next to this town -----//
 
-		if( targetTown->has_linked_camp(nation_recno, 0) )		//0-count both camps with or without overseers
-			continue;
+//--------- Begin of function Nation::rate_capture_enemy_town_target --------//
+//
+// Rate an enemy town as the target of think_capture_enemy_town_target().
+// It only reads the game state, as it is called on worker threads.
+//
+// <Town*> capturerTown    - our town to capture enemy towns.
+// <Town*> targetTown      - the town to rate
+// <int>   ourMilitary     - military_rank_rating() of this nation
+// <int&>  curRating       - for returning the rating of the town
+// <int&>  townCombatLevel - for returning the combat level of the town
+//
+// return: <int> 0 - the town is not a target
+//               1 - the town has been rated
+//               2 - the town has no linked camps, capture it immediately
+//
+int Nation::rate_capture_enemy_town_target(Town* capturerTown, Town* targetTown, int ourMilitary, int& curRating, int& townCombatLevel)
+{
+	Firm* firmPtr;
+	int  	hasWar;
 
-		//--------- only attack enemies -----------//
+	if( targetTown->nation_recno == 0 ||
+		 targetTown->nation_recno == nation_recno )
+	{
+		return 0;
+	}
 
-		NationRelation* nationRelation = get_relation(targetTown->nation_recno);
+	if( targetTown->region_id != capturerTown->region_id )
+		return 0;
 
-		int rc=0;
+	//----- if we have already built a camp next to this town -----//
 
-		if( nationRelation->status == NATION_HOSTILE )
-			rc = 1;
+	if( targetTown->has_linked_camp(nation_recno, 0) )		//0-count both camps with or without overseers
+		return 0;
 
-		else if( nationRelation->ai_relation_level < 10 )			// even if the relation is not hostile, if the ai_relation_level is < 10, attack anyway
-			rc = 1;
+	//--------- only attack enemies -----------//
 
-		else if( nationRelation->status <= NATION_NEUTRAL &&
-			 targetTown->nation_recno == nation_array.max_overall_nation_recno &&		// if this is our biggest enemy
-			 nationRelation->ai_relation_level < 30 )
-		{
-			rc = 1;
-		}
+	NationRelation* nationRelation = get_relation(targetTown->nation_recno);
 
-		if( !rc )
-			continue;
+	int rc=0;
 
-		//----- if this town does not have any linked camps, capture this town immediately -----//
+	if( nationRelation->status == NATION_HOSTILE )
+		rc = 1;
 
-		if( targetTown->has_linked_camp(targetTown->nation_recno, 0) )		//0-count both camps with or without overseers
-			return targetTown;
+	else if( nationRelation->ai_relation_level < 10 )			// even if the relation is not hostile, if the ai_relation_level is < 10, attack anyway
+		rc = 1;
 
-		//--- if the enemy is very powerful overall, don't attack it yet ---//
+	else if( nationRelation->status <= NATION_NEUTRAL &&
+		 targetTown->nation_recno == nation_array.max_overall_nation_recno &&		// if this is our biggest enemy
+		 nationRelation->ai_relation_level < 30 )
+	{
+		rc = 1;
+	}
 
-		if( nation_array[targetTown->nation_recno]->military_rank_rating() >
-			 ourMilitary * (80+pref_military_courage/2) / 100 )
-		{
-			continue;
-		}
+	if( !rc )
+		return 0;
 
-		//------ only attack if we have enough money to support the war ----//
+	//----- if this town does not have any linked camps, capture this town immediately -----//
 
-		if( !ai_should_spend_war( nation_array[targetTown->nation_recno]->military_rank_rating() ) )
-			continue;
+	if( targetTown->has_linked_camp(targetTown->nation_recno, 0) )		//0-count both camps with or without overseers
+		return 2;
 
-		//-------------------------------------------------------//
+	//--- if the enemy is very powerful overall, don't attack it yet ---//
 
-		int townCombatLevel = enemy_town_combat_level(targetTown, 1, hasWar);		// 1-return a rating if there is war with the town
+	if( nation_array[targetTown->nation_recno]->military_rank_rating() >
+		 ourMilitary * (80+pref_military_courage/2) / 100 )
+	{
+		return 0;
+	}
 
-		if( townCombatLevel == -1 )      // do not attack this town because a battle is already going on
-			continue;
+	//------ only attack if we have enough money to support the war ----//
 
-		//------- calculate the rating --------------//
+	if( !ai_should_spend_war( nation_array[targetTown->nation_recno]->military_rank_rating() ) )
+		return 0;
 
-		curRating = world.distance_rating(capturerTown->center_x, capturerTown->center_y,
-						targetTown->center_x, targetTown->center_y);
+	//-------------------------------------------------------//
 
-		curRating -= townCombatLevel/10;
+	townCombatLevel = enemy_town_combat_level(targetTown, 1, hasWar);		// 1-return a rating if there is war with the town
 
-		curRating -= targetTown->average_loyalty();
+	if( townCombatLevel == -1 )      // do not attack this town because a battle is already going on
+		return 0;
 
-		curRating += targetTown->population;		// put a preference on capturing villages with large population
+	//------- calculate the rating --------------//
 
-		//----- the power of between the nation also affect the rating ----//
+	curRating = world.distance_rating(capturerTown->center_x, capturerTown->center_y,
+					targetTown->center_x, targetTown->center_y);
 
-		curRating += 2 * (ourMilitary - nation_array[targetTown->nation_recno]->military_rank_rating());
+	curRating -= townCombatLevel/10;
 
-		//-- AI Aggressive is set above Low, than the AI will try to capture the player's town first ---//
+	curRating -= targetTown->average_loyalty();
 
-		if( !targetTown->ai_town )
-		{
-			if( game.game_mode == GAME_TUTORIAL )		// next attack the player in a tutorial game
-			{
-				continue;
-			}
-			else
-			{
-				switch( config.ai_aggressiveness )
-				{
-					case OPTION_MODERATE:
-						curRating += 100;
-						break;
+	curRating += targetTown->population;		// put a preference on capturing villages with large population
 
-					case OPTION_HIGH:
-						curRating += 300;
-						break;
+	//----- the power of between the nation also affect the rating ----//
 
-					case OPTION_VERY_HIGH:
-						curRating += 500;
-						break;
-				}
-			}
-		}
+	curRating += 2 * (ourMilitary - nation_array[targetTown->nation_recno]->military_rank_rating());
 
-		//--- if there are mines linked to this town, increase its rating ---//
+	//-- AI Aggressive is set above Low, than the AI will try to capture the player's town first ---//
 
-		for( int i=targetTown->linked_firm_count-1 ; i>=0 ; i-- )
+	if( !targetTown->ai_town )
+	{
+		if( game.game_mode == GAME_TUTORIAL )		// next attack the player in a tutorial game
 		{
-			firmPtr = firm_array[ targetTown->linked_firm_array[i] ];
-
-			if( firmPtr->nation_recno != targetTown->nation_recno )
-				continue;
-
-			if( firmPtr->firm_id == FIRM_MINE )
+			return 0;
+		}
+		else
+		{
+			switch( config.ai_aggressiveness )
 			{
-				//--- if this mine's raw materials is one that we don't have --//
+				case OPTION_MODERATE:
+					curRating += 100;
+					break;
+
+				case OPTION_HIGH:
+					curRating += 300;
+					break;
 
-				if( raw_count_array[ ((FirmMine*)firmPtr)->raw_id-1 ]==0 )
-					curRating += 150 * (int) ((FirmMine*)firmPtr)->reserve_qty / MAX_RAW_RESERVE_QTY;
+				case OPTION_VERY_HIGH:
+					curRating += 500;
+					break;
 			}
 		}
+	}
 
-		//--- more linked towns increase the attractiveness rating ---//
+	//--- if there are mines linked to this town, increase its rating ---//
 
-		curRating += targetTown->linked_firm_count*5;
+	for( int i=targetTown->linked_firm_count-1 ; i>=0 ; i-- )
+	{
+		firmPtr = firm_array[ targetTown->linked_firm_array[i] ];
 
-		//-------- compare with the current best rating ---------//
+		if( firmPtr->nation_recno != targetTown->nation_recno )
+			continue;
 
-		if( curRating > bestRating )
+		if( firmPtr->firm_id == FIRM_MINE )
 		{
-			bestRating    = curRating;
-			bestTown      = targetTown;
-			neededCombatLevel = townCombatLevel;
+			//--- if this mine's raw materials is one that we don't have --//
+
+			if( raw_count_array[ ((FirmMine*)firmPtr)->raw_id-1 ]==0 )
+				curRating += 150 * (int) ((FirmMine*)firmPtr)->reserve_qty / MAX_RAW_RESERVE_QTY;
 		}
 	}
 
-	return bestTown;
+	//--- more linked towns increase the attractiveness rating ---//
+
+	curRating += targetTown->linked_firm_count*5;
+
+	return 1;
 }
-//-------- End of function Nation::think_capture_enemy_town_target ------//
+//-------- End of function Nation::rate_capture_enemy_town_target ------//
 
 
 //--------- Begin of function Nation::enemy_town_combat_level --------//
@@ -563,12 +612,26 @@ int Nation::mobile_defense_combat_level(int targetXLoc, int targetYLoc, int targ
 
 	hasWar = 0;
 
+	if( !world.area_unit_count(xLoc1, yLoc1, xLoc2, yLoc2) )
+		return 0;
+
 	for( yLoc=yLoc1 ; yLoc<=yLoc2 ; yLoc++ )
 	{
 		locPtr = world.get_loc(xLoc1, yLoc);
 
 		for( xLoc=xLoc1 ; xLoc<=xLoc2 ; xLoc++, locPtr++ )
 		{
+			//--- skip to the last location of an empty unit block ---//
+
+			if( !world.block_unit_count(xLoc, yLoc) )
+			{
+				int skipCount = MIN( xLoc | (UNIT_BLOCK_SIZE-1), xLoc2 ) - xLoc;
+
+				xLoc   += skipCount;
+				locPtr += skipCount;
+				continue;
+			}
+
 			if( !locPtr->has_unit(UNIT_LAND) )
 				continue;
 
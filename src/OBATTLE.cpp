@@ -44,6 +44,7 @@
 #include <CmdLine.h>
 #include <FilePath.h>
 #include <ConfigAdv.h>
+#include <ReplayCheck.h>
 
 //---------- define static functions -------------//
 
@@ -652,19 +653,36 @@ void Battle::run_loaded()
 
 //-------- Begin of function Battle::run_replay --------//
 //
-void Battle::run_replay()
+// [char*] replayPath = the replay file to play
+//                      (default: NONAME.RPL in the config directory)
+//
+// return : <int> 1 - the replay has been played
+//                0 - it cannot be loaded
+//
+int Battle::run_replay(const char* replayPath)
 {
-	NewNationPara *mpGame = (NewNationPara *)mem_add(sizeof(NewNationPara)*MAX_NATION);
-	int mpPlayerCount = 0;
 	FilePath full_path(sys.dir_config);
-	Config tmpConfig = config;
 
-	full_path += "NONAME.RPL";
+	if( replayPath )
+		full_path = replayPath;
+	else
+		full_path += "NONAME.RPL";
+
 	if( full_path.error_flag )
-		return;
+		return 0;
+
+	NewNationPara *mpGame = (NewNationPara *)mem_add(sizeof(NewNationPara)*MAX_NATION);
+	int mpPlayerCount = 0;
+	Config tmpConfig = config;
 
 	if( !remote.init_replay_load(full_path, mpGame, &mpPlayerCount) )
-		return;
+	{
+		mem_del(mpGame);
+		return 0;
+	}
+
+	if( replay_check.is_active() )
+		remote.sync_test_level |= 2;		// take the object checksums for ReplayCheck
 
 	game.init();
 	game.game_mode = GAME_DEMO;
@@ -674,6 +692,8 @@ void Battle::run_replay()
 	remote.deinit();
 	game.deinit();
 	config = tmpConfig;
+
+	return 1;
 }
 //--------- End of function Battle::run_replay ---------//
 
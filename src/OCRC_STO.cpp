@@ -31,6 +31,7 @@
 #include <OTALKRES.h>
 #include <OREMOTE.h>
 #include <OCRC_STO.h>
+#include <OFLTREC.h>
 #include <CRC.h>
 
 CrcStore::CrcStore() :
@@ -198,6 +199,8 @@ void CrcStore::record_all()
 	record_spies();
 	record_talk_msgs();
 	frame_check_num = all_crc.crc8();
+
+	FLIGHT_REC("crc_store.record_all", frame_check_num);
 }
 
 
@@ -303,6 +306,8 @@ int CrcStore::compare_remote(uint32_t remoteMsgId, char *dataPtr)
 		crc_error_string += "discrepency, offset : ";
 		crc_error_string += diffOffset;
 		// ###### patch end Gilbert 23/1 #######//
+
+		flight_recorder.dump(arrayName);
 		diffOffset = 0;		// dummy code
 	}
 	return rc;
@@ -315,6 +320,7 @@ int CrcStore::compare_frame(char *dataPtr)
 {
 	if( *(CRC_TYPE*)dataPtr != frame_check_num )
 	{
+		flight_recorder.dump("crc mismatch");
 		send_all();
 		return 1;
 	}
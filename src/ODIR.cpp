@@ -88,6 +88,7 @@ int Directory::read(const char *fileSpec, int sortName)
       fileInfo.time.day = sysTime.wDay;
       fileInfo.time.hour = sysTime.wHour;
       fileInfo.time.minute = sysTime.wMinute;
+      fileInfo.mod_time = ((int64_t)findData.ftLastWriteTime.dwHighDateTime << 32) | findData.ftLastWriteTime.dwLowDateTime;
 
       linkin( &fileInfo );
 
@@ -119,6 +120,7 @@ int Directory::read(const char *fileSpec, int sortName)
       fileInfo.time.day = time->tm_mday;
       fileInfo.time.hour = time->tm_hour;
       fileInfo.time.minute = time->tm_min;
+      fileInfo.mod_time = file_stat.st_mtime;
 
       linkin(&fileInfo);
    }
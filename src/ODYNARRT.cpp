@@ -0,0 +1,70 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    :: ODYNARRT.CPP
+//Description :: File header of the Typed Dynamic Array
+
+#include <ODYNARRT.h>
+#include <file_io_visitor.h>
+
+using namespace FileIOVisitor;
+
+//------- Define constant -------//
+
+enum { DYN_ARRAY_RECORD_SIZE = 29 };		// must match DynArray::write_file()
+
+
+//------- Begin of static function visit_dyn_array_header -------//
+//
+// The same fields in the same order as visit_dyn_array() in ODYNARR.cpp.
+//
+template <typename Visitor>
+static void visit_dyn_array_header(Visitor *v, DynArrayFileHeader *h)
+{
+	visit<int32_t>(v, &h->ele_num);
+	visit<int32_t>(v, &h->block_num);
+	visit<int32_t>(v, &h->cur_pos);
+	visit<int32_t>(v, &h->last_ele);
+	visit<int32_t>(v, &h->ele_size);
+	visit<int32_t>(v, &h->sort_offset);
+	visit<int8_t>(v, &h->sort_type);
+	v->skip(4); /* DynArray::body_buf */
+}
+//------- End of static function visit_dyn_array_header -------//
+
+
+//------- Begin of function write_dyn_array_header -------//
+//
+int write_dyn_array_header(File* filePtr, DynArrayFileHeader* fileHeader)
+{
+	return write_with_record_size(filePtr, fileHeader, &visit_dyn_array_header<FileWriterVisitor>,
+											DYN_ARRAY_RECORD_SIZE);
+}
+//------- End of function write_dyn_array_header -------//
+
+
+//------- Begin of function read_dyn_array_header -------//
+//
+int read_dyn_array_header(File* filePtr, DynArrayFileHeader* fileHeader)
+{
+	return read_with_record_size(filePtr, fileHeader, &visit_dyn_array_header<FileReaderVisitor>,
+										  DYN_ARRAY_RECORD_SIZE);
+}
+//------- End of function read_dyn_array_header -------//
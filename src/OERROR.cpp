@@ -32,6 +32,7 @@
 
 #include <OSYS.h>
 #include <OBOX.h>
+#include <OFLTREC.h>
 
 #include <dbglog.h>
 #include <CmdLine.h>
@@ -112,6 +113,8 @@ void Error::internal(char* errMsg,const char* fileName,int lineNum)
 	if( extra_handler )		// all the extra error handler first
 		(*extra_handler)();
 
+	flight_recorder.dump("error");
+
 	if( errMsg )
 		sprintf(strBuf, "Error : %s\nFile : %s\nLine : %d\n", errMsg,fileName,lineNum );
 	else
@@ -158,6 +161,8 @@ void Error::mem()
 	if( extra_handler )
 		(*extra_handler)();
 
+	flight_recorder.dump("error");
+
 	const char* strBuf = "Insufficient Memory, execution interrupt.";
 
 	//-------- display error message -------//
@@ -245,6 +250,8 @@ void Error::run( const char *format, ... )
 	if( extra_handler )
 		(*extra_handler)();
 
+	flight_recorder.dump("error");
+
 	//---- translate the message and the arguments into one message ----//
 
 	char strBuf[100];
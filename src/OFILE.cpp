@@ -24,9 +24,11 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
+#include <ALL.h>
 #include <dbglog.h>
 #include "OERROR.h"
 #include <OFILE.h>
+#include <OFILEPRE.h>
 #include <errno.h>
 
 DBGLOG_DEFAULT_CHANNEL(File);
@@ -55,9 +57,21 @@ int File::file_open(const char* fileName, int handleError, int fileType)
 		return 0;
 	}
 
-	if (file_handle != NULL)
+	if (is_open())
 		file_close();
 
+	//------ use the file if it has been read ahead ------//
+
+	char* dataBuf;
+	long  dataSize;
+
+	if( file_preload.take(fileName, dataBuf, dataSize) )
+	{
+		file_open_mem(dataBuf, dataSize, handleError, fileType);
+		strcpy(file_name, fileName);
+		return 1;
+	}
+
 	strcpy(file_name, fileName);
 	handle_error = handleError;
 	file_type = (FileType)fileType;
@@ -99,6 +113,9 @@ int File::file_create(const char* fileName, int handleError, int fileType)
 		return 0;
 	}
 
+	if (is_open())
+		file_close();
+
 	strcpy(file_name, fileName);
 	handle_error = handleError;
 	file_type = (FileType)fileType;
@@ -115,6 +132,68 @@ int File::file_create(const char* fileName, int handleError, int fileType)
 }
 //---------- End of function File::file_create ----------//
 
+
+//-------- Begin of function File::file_create_mem ----------//
+//
+// Create a new file in memory, e.g. to compress it before it is written
+// to disk. The data is kept in file_mem_buf() until the file is closed.
+//
+// [int]   handleError   = Treat RW operation failures as fatal or not
+//                         (default true, 1).
+// [int]   fileType = FLAT (0, default) or STRUCTURED (1).
+//
+// return : 1-success, 0-fail
+//
+int File::file_create_mem(int handleError, int fileType)
+{
+	if (is_open())
+		file_close();
+
+	strcpy(file_name, "(memory)");
+	handle_error = handleError;
+	file_type = (FileType)fileType;
+
+	mem_alloc_size = MEM_FILE_ALLOC_SIZE;
+	mem_buf = mem_add(mem_alloc_size);
+	mem_size = 0;
+	mem_pos = 0;
+
+	return 1;
+}
+//---------- End of function File::file_create_mem ----------//
+
+
+//-------- Begin of function File::file_open_mem ----------//
+//
+// Open a file in memory for reading.
+//
+// <char*> dataBuf       = the data of the file, allocated with mem_add().
+//                         The file takes it over and frees it when closed.
+// <long>  dataSize      = size of the data
+// [int]   handleError   = Treat RW operation failures as fatal or not
+//                         (default true, 1).
+// [int]   fileType = FLAT (0, default) or STRUCTURED (1).
+//
+// return : 1-success, 0-fail
+//
+int File::file_open_mem(char* dataBuf, long dataSize, int handleError, int fileType)
+{
+	if (is_open())
+		file_close();
+
+	strcpy(file_name, "(memory)");
+	handle_error = handleError;
+	file_type = (FileType)fileType;
+
+	mem_buf = dataBuf;
+	mem_alloc_size = dataSize;
+	mem_size = dataSize;
+	mem_pos = 0;
+
+	return 1;
+}
+//---------- End of function File::file_open_mem ----------//
+
 //-------- Begin of function File::file_close ----------//
 //
 void File::file_close()
@@ -125,10 +204,75 @@ void File::file_close()
 		fclose(file_handle);
 		file_handle = NULL;
 	}
+
+	if (mem_buf != NULL)
+	{
+		file_name[0] = '\0';
+		mem_del(mem_buf);
+		mem_buf = NULL;
+	}
 }
 //---------- End of function File::file_close ----------//
 
 
+//-------- Begin of function File::raw_write ----------//
+//
+// Write a block of data to the disk file or the memory file.
+//
+// return : 1-success, 0-fail
+//
+int File::raw_write(const void* dataBuf, unsigned dataSize)
+{
+	if (mem_buf)
+	{
+		if (mem_pos + (long) dataSize > mem_alloc_size)
+		{
+			mem_alloc_size = MAX(mem_alloc_size * 2, mem_pos + (long) dataSize);
+			mem_buf = mem_resize(mem_buf, mem_alloc_size);
+		}
+
+		memcpy(mem_buf + mem_pos, dataBuf, dataSize);
+		mem_pos += dataSize;
+
+		if (mem_pos > mem_size)
+			mem_size = mem_pos;
+
+		return 1;
+	}
+
+	fwrite(dataBuf, 1, dataSize, file_handle);
+
+	return !ferror(file_handle);
+}
+//---------- End of function File::raw_write ----------//
+
+
+//-------- Begin of function File::raw_read ----------//
+//
+// Read a block of data from the disk file or the memory file. Like
+// fread(), reading past the end of the file is not an error.
+//
+// return : 1-success, 0-fail
+//
+int File::raw_read(void* dataBuf, unsigned dataSize)
+{
+	if (mem_buf)
+	{
+		long readSize = MIN((long) dataSize, mem_size - mem_pos);
+
+		memcpy(dataBuf, mem_buf + mem_pos, readSize);
+		mem_pos += readSize;
+
+		return 1;
+	}
+
+	fread(dataBuf, 1, dataSize, file_handle);
+
+	return !ferror(file_handle);
+}
+//---------- End of function File::raw_read ----------//
+
+
 //-------- Begin of function File::~File ----------//
 //
 File::~File()
@@ -149,7 +293,7 @@ File::~File()
 //
 int File::file_write(void* dataBuf, unsigned dataSize)
 {
-	err_when(!file_handle);
+	err_when(!is_open());
 
 	if (file_type == File::STRUCTURED)
 	{
@@ -169,9 +313,7 @@ int File::file_write(void* dataBuf, unsigned dataSize)
 		}
 	}
 
-	fwrite(dataBuf, 1, dataSize, file_handle);
-
-	if (ferror(file_handle))
+	if (!raw_write(dataBuf, dataSize))
 	{
 		if (handle_error)
 			err.run("[File::file_write] error occured while writing file: %s\n", file_name);
@@ -196,7 +338,7 @@ int File::file_write(void* dataBuf, unsigned dataSize)
 //
 int File::file_read(void* dataBuf, unsigned dataSize)
 {
-	err_when(!file_handle);
+	err_when(!is_open());
 
 	unsigned bytesToRead = dataSize, recordSize = dataSize;
 
@@ -207,7 +349,7 @@ int File::file_read(void* dataBuf, unsigned dataSize)
 			bytesToRead = recordSize; // the read size is the minimum of the record size and the supposed read size
 	}
 
-	fread(dataBuf, 1, bytesToRead, file_handle);
+	int rc = raw_read(dataBuf, bytesToRead);
 
 	// In the case of file_type == File::STRUCTURED
 	// if the record was read partially,
@@ -221,7 +363,7 @@ int File::file_read(void* dataBuf, unsigned dataSize)
 	if (bytesToRead < dataSize)
 		memset((char*)dataBuf + bytesToRead, 0, dataSize - bytesToRead);
 
-	if (ferror(file_handle))
+	if (!rc)
 	{
 		// This used to prompt for a retry -- was this necessary?
 		if (handle_error)
@@ -238,11 +380,9 @@ int File::file_read(void* dataBuf, unsigned dataSize)
 
 int File::file_put_char(int8_t value)
 {
-	err_when(!file_handle);
-
-	fwrite(&value, 1, sizeof(int8_t), file_handle);
+	err_when(!is_open());
 
-	if (ferror(file_handle))
+	if (!raw_write(&value, sizeof(int8_t)))
 	{
 		if (handle_error)
 			err.run("[File::file_put_short] error occured while writing file: %s\n", file_name);
@@ -256,12 +396,10 @@ int File::file_put_char(int8_t value)
 
 int8_t File::file_get_char()
 {
-	err_when(!file_handle);
+	err_when(!is_open());
 
 	int8_t value;
-	fread(&value, 1, sizeof(int8_t), file_handle);
-
-	if (ferror(file_handle))
+	if (!raw_read(&value, sizeof(int8_t)))
 	{
 		if (handle_error)
 			err.run("[File::file_get_char] error occured while reading file: %s\n", file_name);
@@ -275,11 +413,9 @@ int8_t File::file_get_char()
 
 int File::file_put_short(int16_t value)
 {
-	err_when(!file_handle);
-
-	fwrite(&value, 1, sizeof(int16_t), file_handle);
+	err_when(!is_open());
 
-	if (ferror(file_handle))
+	if (!raw_write(&value, sizeof(int16_t)))
 	{
 		if (handle_error)
 			err.run("[File::file_put_char] error occured while writing file: %s\n", file_name);
@@ -293,12 +429,10 @@ int File::file_put_short(int16_t value)
 
 int16_t File::file_get_short()
 {
-    	err_when(!file_handle);
+    	err_when(!is_open());
 
     int16_t value;
-    fread(&value, 1, sizeof(int16_t), file_handle);
-
-	if (ferror(file_handle))
+    if (!raw_read(&value, sizeof(int16_t)))
 	{
 		if (handle_error)
 			err.run("[File::file_get_short] error occured while reading file: %s\n", file_name);
@@ -312,11 +446,9 @@ int16_t File::file_get_short()
 
 int File::file_put_unsigned_short(uint16_t value)
 {
-    	err_when(!file_handle);
+    	err_when(!is_open());
 
-    fwrite(&value, 1, sizeof(uint16_t), file_handle);
-
-	if (ferror(file_handle))
+    if (!raw_write(&value, sizeof(uint16_t)))
 	{
 		if (handle_error)
 			err.run("[File::file_put_unsigned_short] error occured while writing file: %s\n", file_name);
@@ -330,12 +462,10 @@ int File::file_put_unsigned_short(uint16_t value)
 
 uint16_t File::file_get_unsigned_short()
 {
-    	err_when(!file_handle);
+    	err_when(!is_open());
 
     uint16_t value;
-    fread(&value, 1, sizeof(uint16_t), file_handle);
-
-	if (ferror(file_handle))
+    if (!raw_read(&value, sizeof(uint16_t)))
 	{
 		if (handle_error)
 			err.run("[File::file_get_unsigned_short] error occured while reading file: %s\n", file_name);
@@ -349,11 +479,9 @@ uint16_t File::file_get_unsigned_short()
 
 int File::file_put_long(int32_t value)
 {
-    	err_when(!file_handle);
-
-    fwrite(&value, 1, sizeof(int32_t), file_handle);
+    	err_when(!is_open());
 
-	if (ferror(file_handle))
+    if (!raw_write(&value, sizeof(int32_t)))
 	{
 		if (handle_error)
 			err.run("[File::file_put_long] error occured while writing file: %s\n", file_name);
@@ -367,12 +495,10 @@ int File::file_put_long(int32_t value)
 
 int32_t File::file_get_long()
 {
-    	err_when(!file_handle);
+    	err_when(!is_open());
 
     int32_t value;
-    fread(&value, 1, sizeof(int32_t), file_handle);
-
-	if (ferror(file_handle))
+    if (!raw_read(&value, sizeof(int32_t)))
 	{
 		if (handle_error)
 			err.run("[File::file_get_long] error occured while reading file: %s\n", file_name);
@@ -389,17 +515,38 @@ int32_t File::file_get_long()
 // return : new offset from the file beginning.
 long File::file_seek(long offset, int whence)
 {
+	if (mem_buf)
+	{
+		long target = offset;
+
+		if (whence == SEEK_CUR)
+			target += mem_pos;
+		else if (whence == SEEK_END)
+			target += mem_size;
+
+		if (target >= 0 && target <= mem_size)
+			mem_pos = target;
+
+		return mem_pos;
+	}
+
 	fseek(file_handle, offset, whence);
 	return ftell(file_handle);
 }
 
 long File::file_pos()
 {
+	if (mem_buf)
+		return mem_pos;
+
 	return ftell(file_handle);
 }
 
 long File::file_size()
 {
+	if (mem_buf)
+		return mem_size;
+
 	long actual = ftell(file_handle);
 	fseek(file_handle, 0, SEEK_END);
 
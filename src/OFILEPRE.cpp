@@ -0,0 +1,247 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : OFILEPRE.CPP
+//Description : Object FilePreload
+
+#include <stdio.h>
+#include <ALL.h>
+#include <OMISC.h>
+#include <OPARALEL.h>
+#include <OFILEPRE.h>
+#include <dbglog.h>
+
+DBGLOG_DEFAULT_CHANNEL(FilePreload);
+
+//------- Begin of function FilePreload::FilePreload -------//
+
+FilePreload::FilePreload()
+{
+	active_flag = false;
+	quit_flag = false;
+	next_entry = 0;
+
+	taken_count = 0;
+	wait_ms = 0;
+}
+//-------- End of function FilePreload::FilePreload --------//
+
+
+//------- Begin of function FilePreload::start -------//
+//
+// Start reading the files, on up to MAX_PARALLEL_THREAD threads.
+//
+// <std::vector<std::string>&> fileNameArray = the files in the order they will be opened
+//
+void FilePreload::start(const std::vector<std::string>& fileNameArray)
+{
+	finish();
+
+	if( fileNameArray.empty() )
+		return;
+
+	entry_array.resize( fileNameArray.size() );
+
+	for( size_t i=0 ; i<fileNameArray.size() ; i++ )
+	{
+		entry_array[i].file_name = fileNameArray[i];
+		entry_array[i].status    = FILE_PRELOAD_QUEUED;
+		entry_array[i].data_buf  = NULL;
+		entry_array[i].data_size = 0;
+	}
+
+	next_entry = 0;
+	quit_flag = false;
+	active_flag = true;
+
+	taken_count = 0;
+	wait_ms = 0;
+
+	int threadCount = std::min( (int) std::thread::hardware_concurrency(), (int) MAX_PARALLEL_THREAD );
+
+	threadCount = std::max( 1, std::min(threadCount, (int) entry_array.size()) );
+
+	for( int t=0 ; t<threadCount ; t++ )
+		thread_array.emplace_back( &FilePreload::read_main, this );
+}
+//-------- End of function FilePreload::start --------//
+
+
+//------- Begin of function FilePreload::finish -------//
+//
+// Stop reading and free the files not taken.
+//
+void FilePreload::finish()
+{
+	{
+		std::lock_guard<std::mutex> lock(preload_mutex);
+
+		if( !active_flag )
+			return;
+
+		quit_flag = true;
+		active_flag = false;
+	}
+
+	preload_cond.notify_all();
+
+	for( size_t t=0 ; t<thread_array.size() ; t++ )
+		thread_array[t].join();
+
+	thread_array.clear();
+
+	if( taken_count )
+		MSG("%lu of %d files read ahead, %lu ms waited for them\n", taken_count, (int) entry_array.size(), wait_ms);
+
+	for( size_t i=0 ; i<entry_array.size() ; i++ )
+	{
+		if( entry_array[i].data_buf )
+			mem_del( entry_array[i].data_buf );
+	}
+
+	entry_array.clear();
+}
+//-------- End of function FilePreload::finish --------//
+
+
+//------- Begin of function FilePreload::take -------//
+//
+// Called by File::file_open() for every file opened.
+//
+// <char*>  fileName = name of the file to be opened
+// <char*&> dataBuf  = for returning the data, allocated with mem_add()
+// <long&>  dataSize = for returning the size of the data
+//
+// return : <int> 1 - the file has been read ahead
+//                0 - it has not, it should be opened as usual
+//
+int FilePreload::take(const char* fileName, char*& dataBuf, long& dataSize)
+{
+	std::unique_lock<std::mutex> lock(preload_mutex);
+
+	if( !active_flag )
+		return 0;
+
+	FilePreloadEntry* entryPtr = NULL;
+
+	for( size_t i=0 ; i<entry_array.size() ; i++ )
+	{
+		if( entry_array[i].file_name == fileName && entry_array[i].status != FILE_PRELOAD_TAKEN )
+		{
+			entryPtr = &entry_array[i];
+			break;
+		}
+	}
+
+	if( !entryPtr )
+		return 0;
+
+	if( entryPtr->status == FILE_PRELOAD_QUEUED )		// not started yet, the caller reads it itself
+	{
+		entryPtr->status = FILE_PRELOAD_TAKEN;
+		return 0;
+	}
+
+	if( entryPtr->status == FILE_PRELOAD_READING )
+	{
+		unsigned long startTime = misc.get_time();
+
+		preload_cond.wait( lock, [entryPtr]() { return entryPtr->status != FILE_PRELOAD_READING; } );
+
+		wait_ms += misc.get_time() - startTime;
+	}
+
+	if( entryPtr->status == FILE_PRELOAD_FAILED )		// let the caller report the error
+	{
+		entryPtr->status = FILE_PRELOAD_TAKEN;
+		return 0;
+	}
+
+	dataSize = entryPtr->data_size;
+	dataBuf  = entryPtr->data_buf;		// the memory file frees it
+
+	entryPtr->data_buf = NULL;
+	entryPtr->status = FILE_PRELOAD_TAKEN;
+
+	taken_count++;
+	return 1;
+}
+//-------- End of function FilePreload::take --------//
+
+
+//------- Begin of function FilePreload::read_main -------//
+//
+// The reading threads take the queued files one by one.
+//
+void FilePreload::read_main()
+{
+	std::unique_lock<std::mutex> lock(preload_mutex);
+
+	while( !quit_flag )
+	{
+		//------ get the next file not taken yet ------//
+
+		while( next_entry < entry_array.size() && entry_array[next_entry].status != FILE_PRELOAD_QUEUED )
+			next_entry++;
+
+		if( next_entry >= entry_array.size() )
+			break;
+
+		FilePreloadEntry* entryPtr = &entry_array[next_entry++];
+		std::string fileName = entryPtr->file_name;
+
+		entryPtr->status = FILE_PRELOAD_READING;
+
+		lock.unlock();
+
+		//--------- read the whole file ---------//
+
+		char* dataBuf = NULL;
+		long  dataSize = 0;
+		FILE* filePtr = fopen(fileName.c_str(), "rb");
+
+		if( filePtr )
+		{
+			if( fseek(filePtr, 0, SEEK_END)==0 && (dataSize = ftell(filePtr)) >= 0 &&
+				 fseek(filePtr, 0, SEEK_SET)==0 )
+			{
+				dataBuf = mem_add( MAX(dataSize, 1L) );
+
+				if( fread(dataBuf, 1, dataSize, filePtr) != (size_t) dataSize )
+				{
+					mem_del( dataBuf );
+					dataBuf = NULL;
+				}
+			}
+
+			fclose( filePtr );
+		}
+
+		lock.lock();
+
+		entryPtr->data_buf  = dataBuf;
+		entryPtr->data_size = dataBuf ? dataSize : 0;
+		entryPtr->status    = dataBuf ? FILE_PRELOAD_DONE : FILE_PRELOAD_FAILED;
+
+		preload_cond.notify_all();
+	}
+}
+//-------- End of function FilePreload::read_main --------//
@@ -37,6 +37,7 @@
 #include <OFIRM.h>
 #include <ORACERES.h>
 #include <OTOWN.h>
+#include <ONATVIEW.h>
 #include <OREMOTE.h>
 #include <OF_CAMP.h>
 #include <OF_HARB.h>
@@ -270,6 +271,8 @@ void Firm::init(int xLoc, int yLoc, int nationRecno, int firmId, const char* bui
 	if( firm_ai )
 		nation_array[nation_recno]->add_firm_info(firm_id, firm_recno);
 
+	nation_view_array.add_firm(firm_recno, nation_recno, firm_id);
+
 	//-------- init derived ---------//
 
 	init_derived();         // init_derived() before set_world_matrix() so that init_derived has access to the original land info.
@@ -290,6 +293,8 @@ void Firm::deinit()
 
 	remove_firm = 1; // set static parameter
 
+	nation_view_array.del_firm(firm_recno, nation_recno, firm_id);
+
 	//------- delete AI info ----------//
 
 	if(firm_ai)
@@ -3468,8 +3473,12 @@ void Firm::change_nation(int newNationRecno)
 
 	release_link();		// need to update link because firms are only linked to firms of the same nation
 
+	nation_view_array.del_firm(firm_recno, nation_recno, firm_id);
+
 	nation_recno = newNationRecno;
 
+	nation_view_array.add_firm(firm_recno, nation_recno, firm_id);
+
 	setup_link();
 
 	//---------------------------------------//
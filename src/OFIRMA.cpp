@@ -343,11 +343,6 @@ int FirmArray::process()
 
 		err_when(firmPtr->firm_recno!=i);
 
-		//-------- system yield ---------//
-
-		if( i%20==1 )
-			sys.yield();
-
 #if defined(DEBUG) && defined(ENABLE_LOG)
 		String logStr;
 		logStr = "begin process firm ";
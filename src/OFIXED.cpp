@@ -0,0 +1,120 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : OFIXED.CPP
+//Description : Fixed-point maths for the game simulation
+
+#include <OFIXED.h>
+
+//------- Define static variables -------//
+
+#define QUARTER_CIRCLE		(FIXED_CIRCLE/4)
+
+// sin() of 0 to 90 degrees in quarters of a degree, times FIXED_ONE
+
+static const int sin_table[QUARTER_CIRCLE+1] =
+{
+	0, 286, 572, 858, 1144, 1430, 1716, 2001,
+	2287, 2573, 2859, 3144, 3430, 3715, 4001, 4286,
+	4572, 4857, 5142, 5427, 5712, 5997, 6281, 6566,
+	6850, 7135, 7419, 7703, 7987, 8271, 8554, 8838,
+	9121, 9404, 9687, 9970, 10252, 10534, 10817, 11098,
+	11380, 11662, 11943, 12224, 12505, 12785, 13066, 13346,
+	13626, 13905, 14185, 14464, 14742, 15021, 15299, 15577,
+	15855, 16132, 16409, 16686, 16962, 17238, 17514, 17789,
+	18064, 18339, 18613, 18887, 19161, 19434, 19707, 19980,
+	20252, 20524, 20795, 21066, 21336, 21607, 21876, 22146,
+	22415, 22683, 22951, 23219, 23486, 23753, 24019, 24285,
+	24550, 24815, 25080, 25343, 25607, 25870, 26132, 26394,
+	26656, 26917, 27177, 27437, 27697, 27956, 28214, 28472,
+	28729, 28986, 29242, 29498, 29753, 30007, 30261, 30515,
+	30767, 31019, 31271, 31522, 31772, 32022, 32271, 32520,
+	32768, 33015, 33262, 33508, 33754, 33998, 34242, 34486,
+	34729, 34971, 35212, 35453, 35693, 35933, 36172, 36410,
+	36647, 36884, 37120, 37355, 37590, 37824, 38057, 38289,
+	38521, 38752, 38982, 39212, 39441, 39669, 39896, 40122,
+	40348, 40573, 40797, 41021, 41243, 41465, 41686, 41906,
+	42126, 42344, 42562, 42779, 42995, 43211, 43425, 43639,
+	43852, 44064, 44275, 44486, 44695, 44904, 45112, 45319,
+	45525, 45730, 45935, 46138, 46341, 46543, 46744, 46944,
+	47143, 47341, 47538, 47735, 47930, 48125, 48318, 48511,
+	48703, 48894, 49084, 49273, 49461, 49648, 49834, 50019,
+	50203, 50387, 50569, 50751, 50931, 51111, 51289, 51467,
+	51643, 51819, 51993, 52167, 52339, 52511, 52682, 52851,
+	53020, 53187, 53354, 53519, 53684, 53847, 54010, 54171,
+	54332, 54491, 54650, 54807, 54963, 55118, 55273, 55426,
+	55578, 55729, 55879, 56028, 56175, 56322, 56468, 56612,
+	56756, 56898, 57040, 57180, 57319, 57457, 57594, 57730,
+	57865, 57999, 58131, 58263, 58393, 58522, 58650, 58777,
+	58903, 59028, 59152, 59274, 59396, 59516, 59635, 59753,
+	59870, 59986, 60100, 60214, 60326, 60437, 60547, 60656,
+	60764, 60870, 60976, 61080, 61183, 61285, 61386, 61485,
+	61584, 61681, 61777, 61872, 61966, 62058, 62149, 62239,
+	62328, 62416, 62503, 62588, 62672, 62755, 62837, 62918,
+	62997, 63075, 63152, 63228, 63303, 63376, 63449, 63520,
+	63589, 63658, 63725, 63791, 63856, 63920, 63983, 64044,
+	64104, 64163, 64220, 64277, 64332, 64386, 64439, 64490,
+	64540, 64589, 64637, 64684, 64729, 64773, 64816, 64858,
+	64898, 64937, 64975, 65012, 65048, 65082, 65115, 65146,
+	65177, 65206, 65234, 65261, 65287, 65311, 65334, 65356,
+	65376, 65396, 65414, 65431, 65446, 65461, 65474, 65485,
+	65496, 65505, 65514, 65520, 65526, 65530, 65534, 65535,
+	65536
+};
+
+//--------- Begin of function fixed_sin ---------//
+//
+// <int> angle = the angle in quarters of a degree, may be negative
+//
+// return : <int> sin() of the angle, times FIXED_ONE
+//
+int fixed_sin(int angle)
+{
+	angle %= FIXED_CIRCLE;
+
+	if( angle < 0 )
+		angle += FIXED_CIRCLE;
+
+	if( angle <= QUARTER_CIRCLE )
+		return sin_table[angle];
+
+	if( angle <= QUARTER_CIRCLE*2 )
+		return sin_table[QUARTER_CIRCLE*2-angle];
+
+	if( angle <= QUARTER_CIRCLE*3 )
+		return -sin_table[angle-QUARTER_CIRCLE*2];
+
+	return -sin_table[FIXED_CIRCLE-angle];
+}
+//----------- End of function fixed_sin ---------//
+
+
+//--------- Begin of function fixed_cos ---------//
+//
+// <int> angle = the angle in quarters of a degree, may be negative
+//
+// return : <int> cos() of the angle, times FIXED_ONE
+//
+int fixed_cos(int angle)
+{
+	return fixed_sin(angle + QUARTER_CIRCLE);
+}
+//----------- End of function fixed_cos ---------//
@@ -0,0 +1,507 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OFLOWFLD.CPP
+//Description : Object FlowField and FlowFieldArray
+
+#include <stdlib.h>
+#include <string.h>
+#include <ALL.h>
+#include <OSYS.h>
+#include <OWORLD.h>
+#include <ONATION.h>
+#include <OSPATH.h>
+#include <ConfigAdv.h>
+#include <OFLOWFLD.h>
+
+//------- Define constant -------//
+
+#define FLOW_FIELD_UNREACHED		0xFFFF
+
+//------- Define static vars -------//
+
+static int step_x_array[8] = {  0,  1, 1, 1, 0, -1, -1, -1 };
+static int step_y_array[8] = { -1, -1, 0, 1, 1,  1,  0, -1 };
+
+//------- Begin of function FlowField::init -------//
+//
+// <int>   destXLoc, destYLoc = the destination of the group
+// <int>   destRange          = how far from the destination the units of the group are placed
+// <int>   nationRecno        = the nation of the group, 0 if the field need not keep out of hostile territory
+// <char*> nationPassable     = Nation::relation_passable_array of the nation
+//
+// The distances are calculated when the field is first used.
+//
+void FlowField::init(int destXLoc, int destYLoc, int destRange, int nationRecno, char* nationPassable)
+{
+	dest_x_loc   = destXLoc;
+	dest_y_loc   = destYLoc;
+	dest_range   = destRange;
+	nation_recno = nationRecno;
+
+	if( nation_recno )
+		memcpy( nation_passable, nationPassable, sizeof(nation_passable) );
+	else
+		memset( nation_passable, 0, sizeof(nation_passable) );
+
+	dist_array = (unsigned short*) mem_resize( dist_array, MAX_WORLD_X_LOC * MAX_WORLD_Y_LOC * sizeof(unsigned short) );
+
+	pass_change_count = world.pass_change_count - 1;		// not calculated yet
+	last_used_frame   = sys.frame_count;
+}
+//-------- End of function FlowField::init --------//
+
+
+//------- Begin of function FlowField::deinit -------//
+
+void FlowField::deinit()
+{
+	if( dist_array )
+	{
+		mem_del( dist_array );
+		dist_array = NULL;
+	}
+}
+//-------- End of function FlowField::deinit --------//
+
+
+//------- Begin of function FlowField::is_passable -------//
+//
+// Whether a land unit of the group may walk on the location, not
+// counting the units on it.
+//
+int FlowField::is_passable(int xLoc, int yLoc)
+{
+	if( !(world.pass_map.get(yLoc*MAX_WORLD_X_LOC+xLoc) & PASS_LAND) )
+		return 0;
+
+	if( !nation_recno )
+		return 1;
+
+	int powerNationRecno = world.get_loc(xLoc, yLoc)->power_nation_recno;
+
+	return !powerNationRecno || nation_passable[powerNationRecno-1];
+}
+//-------- End of function FlowField::is_passable --------//
+
+
+//------- Begin of function FlowField::can_step -------//
+//
+// Whether a unit on the passable location can step to the adjacent
+// location in the given direction, which must be passable too.
+// Diagonal steps do not cut the corners of impassable locations.
+//
+int FlowField::can_step(int xLoc, int yLoc, int stepX, int stepY)
+{
+	if( !stepX || !stepY )
+		return 1;
+
+	return is_passable(xLoc+stepX, yLoc) && is_passable(xLoc, yLoc+stepY);
+}
+//-------- End of function FlowField::can_step --------//
+
+
+//------- Begin of function FlowField::is_out_of_date -------//
+//
+// Whether the map has changed since the distances were calculated.
+// A field kept out of hostile territory also depends on the power
+// areas of the nations, see is_passable().
+//
+int FlowField::is_out_of_date()
+{
+	if( pass_change_count != world.pass_change_count )
+		return 1;
+
+	return nation_recno && power_change_count != world.power_change_count;
+}
+//-------- End of function FlowField::is_out_of_date --------//
+
+
+//------- Begin of function FlowField::calc_dist -------//
+//
+// Calculate the distances of all locations going out from the
+// destination.
+//
+void FlowField::calc_dist()
+{
+	int locCount = MAX_WORLD_X_LOC * MAX_WORLD_Y_LOC;
+	int* queueArray = (int*) mem_add( locCount * sizeof(int) );
+	int queueHead = 0, queueTail = 0;
+
+	memset( dist_array, 0xFF, locCount * sizeof(unsigned short) );		// FLOW_FIELD_UNREACHED
+
+	int locOffset = dest_y_loc*MAX_WORLD_X_LOC + dest_x_loc;
+
+	dist_array[locOffset] = 0;
+	queueArray[queueTail++] = locOffset;
+
+	while( queueHead < queueTail )
+	{
+		locOffset = queueArray[queueHead++];
+
+		int xLoc = locOffset % MAX_WORLD_X_LOC;
+		int yLoc = locOffset / MAX_WORLD_X_LOC;
+		unsigned short nextDist = dist_array[locOffset] + 1;
+
+		for( int i=0 ; i<8 ; i++ )
+		{
+			int x = xLoc + step_x_array[i];
+			int y = yLoc + step_y_array[i];
+
+			if( x<0 || x>=MAX_WORLD_X_LOC || y<0 || y>=MAX_WORLD_Y_LOC )
+				continue;
+
+			int adjOffset = y*MAX_WORLD_X_LOC + x;
+
+			if( dist_array[adjOffset] != FLOW_FIELD_UNREACHED )
+				continue;
+
+			//--- the unit on the adjacent location steps back towards this one ---//
+
+			if( !is_passable(x, y) || !can_step(x, y, -step_x_array[i], -step_y_array[i]) )
+				continue;
+
+			dist_array[adjOffset] = nextDist;
+			queueArray[queueTail++] = adjOffset;
+		}
+	}
+
+	mem_del( queueArray );
+
+	pass_change_count = world.pass_change_count;
+	power_change_count = world.power_change_count;
+}
+//-------- End of function FlowField::calc_dist --------//
+
+
+//------- Begin of function FlowField::can_use -------//
+//
+// Whether the field can take a unit of the group from the start
+// location to near its destination.
+//
+int FlowField::can_use(int startXLoc, int startYLoc, int destXLoc, int destYLoc)
+{
+	if( MAX(abs(destXLoc-startXLoc), abs(destYLoc-startYLoc)) <= FLOW_FIELD_SEEK_RANGE )		// close enough for seeking a path
+		return 0;
+
+	if( is_out_of_date() )
+		calc_dist();
+
+	int startDist = dist_array[startYLoc*MAX_WORLD_X_LOC + startXLoc];
+
+	return startDist != FLOW_FIELD_UNREACHED && startDist > 0;
+}
+//-------- End of function FlowField::can_use --------//
+
+
+//------- Begin of function FlowField::get_path -------//
+//
+// Follow the field from the start location until near the unit's own
+// destination, then seek a path for the rest of the way. can_use()
+// must have returned 1 for the locations.
+//
+// <int>      startXLoc, startYLoc = the location of the unit
+// <int>      destXLoc, destYLoc   = the destination of the unit
+// <uint32_t> groupId              = the unit_group_id of the unit
+// <int&>     nodeCount            = for returning the no. of nodes in the path
+// <short&>   pathDist             = for returning the distance of the path
+//
+// return : <ResultNode*> the path, the same as SeekPath::get_result()
+//
+ResultNode* FlowField::get_path(int startXLoc, int startYLoc, int destXLoc, int destYLoc, uint32_t groupId, int& nodeCount, short& pathDist)
+{
+	err_when( is_out_of_date() );
+
+	int xLoc = startXLoc, yLoc = startYLoc;
+	int locOffset = yLoc*MAX_WORLD_X_LOC + xLoc;
+
+	//------ the turning points going down the field ------//
+
+	ResultNode* nodeArray = (ResultNode*) mem_add( sizeof(ResultNode) * (dist_array[locOffset]+2) );
+	int lastDir = -1;
+
+	nodeArray[0].node_x = xLoc;
+	nodeArray[0].node_y = yLoc;
+	nodeCount = 1;
+	pathDist = 0;
+
+	while( dist_array[locOffset] &&
+			 MAX(abs(destXLoc-xLoc), abs(destYLoc-yLoc)) > FLOW_FIELD_SEEK_RANGE )
+	{
+		int bestDir = -1;
+		int bestDist = dist_array[locOffset];
+
+		for( int j=0 ; j<8 ; j++ )
+		{
+			int i = lastDir>=0 ? (lastDir+j)&7 : j;		// keep going the same way if it is as good
+			int x = xLoc + step_x_array[i];
+			int y = yLoc + step_y_array[i];
+
+			if( x<0 || x>=MAX_WORLD_X_LOC || y<0 || y>=MAX_WORLD_Y_LOC )
+				continue;
+
+			if( dist_array[y*MAX_WORLD_X_LOC+x] < bestDist &&
+				 can_step(xLoc, yLoc, step_x_array[i], step_y_array[i]) )
+			{
+				bestDir = i;
+				bestDist = dist_array[y*MAX_WORLD_X_LOC+x];
+			}
+		}
+
+		if( bestDir<0 )
+			break;
+
+		if( bestDir!=lastDir && pathDist )		// a turning point
+		{
+			nodeArray[nodeCount].node_x = xLoc;
+			nodeArray[nodeCount].node_y = yLoc;
+			nodeCount++;
+		}
+
+		xLoc += step_x_array[bestDir];
+		yLoc += step_y_array[bestDir];
+		locOffset = yLoc*MAX_WORLD_X_LOC + xLoc;
+		lastDir = bestDir;
+		pathDist++;
+	}
+
+	if( !pathDist )
+	{
+		mem_del( nodeArray );
+		nodeCount = 0;
+		return NULL;
+	}
+
+	nodeArray[nodeCount].node_x = xLoc;
+	nodeArray[nodeCount].node_y = yLoc;
+	nodeCount++;
+
+	//------ seek a path from the end of the field to the destination ------//
+
+	if( xLoc!=destXLoc || yLoc!=destYLoc )
+	{
+		int   seekNodeCount;
+		short seekDist;
+
+		seek_path.seek(xLoc, yLoc, destXLoc, destYLoc, groupId, UNIT_LAND);
+
+		ResultNode* seekNodeArray = seek_path.get_result(seekNodeCount, seekDist);
+
+		if( seekNodeArray )
+		{
+			err_when( seekNodeArray[0].node_x!=xLoc || seekNodeArray[0].node_y!=yLoc );
+
+			if( seekNodeCount > 1 )
+			{
+				nodeArray = (ResultNode*) mem_resize( nodeArray, sizeof(ResultNode) * (nodeCount+seekNodeCount-1) );
+				memcpy( nodeArray+nodeCount, seekNodeArray+1, sizeof(ResultNode) * (seekNodeCount-1) );
+
+				nodeCount += seekNodeCount-1;
+				pathDist  += seekDist;
+			}
+
+			mem_del( seekNodeArray );
+		}
+	}
+
+	return nodeArray;
+}
+//-------- End of function FlowField::get_path --------//
+
+
+//------- Begin of function FlowFieldArray::FlowFieldArray -------//
+
+FlowFieldArray::FlowFieldArray()
+{
+	memset( group_array, 0, sizeof(group_array) );
+	next_group_slot = 0;
+}
+//-------- End of function FlowFieldArray::FlowFieldArray --------//
+
+
+//------- Begin of function FlowFieldArray::deinit -------//
+//
+// Free all fields. Called when the game ends, and before the game is
+// sent to other players, as they start without fields.
+//
+void FlowFieldArray::deinit()
+{
+	for( int i=0 ; i<MAX_FLOW_FIELD ; i++ )
+		field_array[i].deinit();
+
+	memset( group_array, 0, sizeof(group_array) );
+	next_group_slot = 0;
+}
+//-------- End of function FlowFieldArray::deinit --------//
+
+
+//------- Begin of function FlowFieldArray::add_group -------//
+//
+// Let a group of land units moving to the destination use a field.
+// Groups moving to the same destination share the field.
+//
+// <uint32_t> groupId            = Unit::unit_group_id of the units
+// <int>      destXLoc, destYLoc = the destination of the group
+// <int>      destRange          = how far from the destination the units of the group are placed
+// <int>      nationRecno        = the nation of the units
+//
+void FlowFieldArray::add_group(uint32_t groupId, int destXLoc, int destYLoc, int destRange, int nationRecno)
+{
+	//--- keep out of hostile territory like SeekPath's SEARCH_SUB_MODE_PASSABLE ---//
+
+	char* nationPassable = NULL;
+
+	if( config_adv.unit_allow_path_power_mode && nationRecno && !nation_array.is_deleted(nationRecno) )
+	{
+		Nation* nationPtr = nation_array[nationRecno];
+		int powerNationRecno = world.get_loc(destXLoc, destYLoc)->power_nation_recno;
+
+		if( !powerNationRecno || nationPtr->get_relation_passable(powerNationRecno) )
+			nationPassable = nationPtr->relation_passable_array;
+	}
+
+	if( !nationPassable )
+		nationRecno = 0;
+
+	//------- look for a field to the same destination -------//
+
+	free_unused_field();
+
+	int i, fieldId = 0;
+	FlowField* fieldPtr;
+
+	for( i=0 ; i<MAX_FLOW_FIELD ; i++ )
+	{
+		fieldPtr = field_array+i;
+
+		if( fieldPtr->is_inited() && fieldPtr->dest_x_loc==destXLoc && fieldPtr->dest_y_loc==destYLoc &&
+			 fieldPtr->nation_recno==nationRecno &&
+			 (!nationRecno || !memcmp(fieldPtr->nation_passable, nationPassable, sizeof(fieldPtr->nation_passable))) )
+		{
+			fieldId = i+1;
+			fieldPtr->dest_range = MAX(fieldPtr->dest_range, destRange);
+			fieldPtr->last_used_frame = sys.frame_count;
+			break;
+		}
+	}
+
+	//---- otherwise use a free field, or the one used longest ago ----//
+
+	if( !fieldId )
+	{
+		for( i=0 ; i<MAX_FLOW_FIELD ; i++ )
+		{
+			fieldPtr = field_array+i;
+
+			if( !fieldPtr->is_inited() )
+			{
+				fieldId = i+1;
+				break;
+			}
+
+			if( !fieldId || fieldPtr->last_used_frame < field_array[fieldId-1].last_used_frame )
+				fieldId = i+1;
+		}
+
+		for( i=0 ; i<MAX_FLOW_FIELD_GROUP ; i++ )		// groups of the field replaced seek paths as before
+		{
+			if( group_array[i].field_id==fieldId )
+				group_array[i].field_id = 0;
+		}
+
+		field_array[fieldId-1].init(destXLoc, destYLoc, destRange, nationRecno, nationPassable);
+	}
+
+	//-------- add the group --------//
+
+	group_array[next_group_slot].group_id = groupId;
+	group_array[next_group_slot].field_id = fieldId;
+
+	next_group_slot = (next_group_slot+1) % MAX_FLOW_FIELD_GROUP;
+}
+//-------- End of function FlowFieldArray::add_group --------//
+
+
+//------- Begin of function FlowFieldArray::get_field -------//
+//
+// Return the field used by the group for moving to the destination,
+// NULL if there is none.
+//
+// A field kept out of hostile territory is dropped when the relations
+// of its nation have changed, as SeekPath would now keep out of other
+// nations. The groups using it seek paths as before.
+//
+FlowField* FlowFieldArray::get_field(uint32_t groupId, int destXLoc, int destYLoc)
+{
+	for( int i=0 ; i<MAX_FLOW_FIELD_GROUP ; i++ )
+	{
+		if( group_array[i].group_id!=groupId || !group_array[i].field_id )
+			continue;
+
+		int fieldId = group_array[i].field_id;
+		FlowField* fieldPtr = field_array + fieldId - 1;
+
+		if( fieldPtr->nation_recno &&
+			 ( nation_array.is_deleted(fieldPtr->nation_recno) ||
+				memcmp(fieldPtr->nation_passable, nation_array[fieldPtr->nation_recno]->relation_passable_array, sizeof(fieldPtr->nation_passable)) ) )
+		{
+			for( int j=0 ; j<MAX_FLOW_FIELD_GROUP ; j++ )
+			{
+				if( group_array[j].field_id==fieldId )
+					group_array[j].field_id = 0;
+			}
+
+			fieldPtr->deinit();
+			return NULL;
+		}
+
+		if( MAX(abs(destXLoc-fieldPtr->dest_x_loc), abs(destYLoc-fieldPtr->dest_y_loc)) <= fieldPtr->dest_range )
+		{
+			fieldPtr->last_used_frame = sys.frame_count;
+			return fieldPtr;
+		}
+	}
+
+	return NULL;
+}
+//-------- End of function FlowFieldArray::get_field --------//
+
+
+//------- Begin of function FlowFieldArray::free_unused_field -------//
+
+void FlowFieldArray::free_unused_field()
+{
+	for( int i=0 ; i<MAX_FLOW_FIELD ; i++ )
+	{
+		FlowField* fieldPtr = field_array+i;
+
+		if( !fieldPtr->is_inited() || sys.frame_count - fieldPtr->last_used_frame <= FLOW_FIELD_EXPIRE_FRAMES )
+			continue;
+
+		fieldPtr->deinit();
+
+		for( int j=0 ; j<MAX_FLOW_FIELD_GROUP ; j++ )
+		{
+			if( group_array[j].field_id==i+1 )
+				group_array[j].field_id = 0;
+		}
+	}
+}
+//-------- End of function FlowFieldArray::free_unused_field --------//
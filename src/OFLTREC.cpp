@@ -0,0 +1,197 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OFLTREC.CPP
+//Description : Object FlightRecorder
+
+#include <stdio.h>
+#include <string.h>
+
+#include <OFLTREC.h>
+#include <OSYS.h>
+#include <OMISC.h>
+#include <OFILE.h>
+#include <ONATIONA.h>
+#include <FilePath.h>
+#include <dbglog.h>
+
+DBGLOG_DEFAULT_CHANNEL(FlightRecorder);
+
+
+//--------- Define constant ---------//
+
+enum { FLIGHT_FILE_VERSION = 1 };
+
+//------ Define struct FlightRecordFileHeader ------//
+//
+// The dump is this header, followed by site_count site names of
+// FLIGHT_SITE_NAME_LEN chars and record_count FlightRecords, oldest first.
+//
+#pragma pack(1)
+struct FlightRecordFileHeader
+{
+	char     magic[4];
+	uint16_t version;
+	uint16_t site_count;
+	uint32_t record_count;
+	int16_t  player_nation_recno;
+	char     reason[FLIGHT_SITE_NAME_LEN];
+};
+#pragma pack()
+
+static const char FLIGHT_FILE_MAGIC[4] = { '7', 'K', 'F', 'R' };
+
+
+//--------- Begin of function FlightRecorder::FlightRecorder ---------//
+//
+FlightRecorder::FlightRecorder()
+{
+	site_name_array[0] = "unknown";		// for call sites beyond MAX_FLIGHT_SITE
+	site_count = 1;
+
+	init();
+}
+//----------- End of function FlightRecorder::FlightRecorder -----------//
+
+
+//--------- Begin of function FlightRecorder::init ---------//
+//
+// Called when a game starts, so that a dump only has records of the
+// current game.
+//
+void FlightRecorder::init()
+{
+	record_count = 0;
+	dump_flag = 0;
+}
+//----------- End of function FlightRecorder::init -----------//
+
+
+//--------- Begin of function FlightRecorder::add_site ---------//
+//
+// Called once for each FLIGHT_REC() call site. The ids depend on the
+// order the sites were first reached, so dumps refer to the sites by
+// name.
+//
+// return : <int> the site id
+//
+int FlightRecorder::add_site(const char* siteName)
+{
+	int siteId = site_count++;
+
+	if( siteId >= MAX_FLIGHT_SITE )
+		return 0;
+
+	site_name_array[siteId] = siteName;
+
+	return siteId;
+}
+//----------- End of function FlightRecorder::add_site -----------//
+
+
+//--------- Begin of function FlightRecorder::record ---------//
+//
+void FlightRecorder::record(int siteId, int value)
+{
+	uint32_t recordId = record_count.fetch_add(1, std::memory_order_relaxed);
+
+	FlightRecord* recordPtr = record_array + (recordId & (MAX_FLIGHT_RECORD-1));
+
+	recordPtr->frame    = sys.frame_count;
+	recordPtr->site_id  = siteId;
+	recordPtr->reserved = 0;
+	recordPtr->seed     = misc.get_random_seed();
+	recordPtr->value    = value;
+}
+//----------- End of function FlightRecorder::record -----------//
+
+
+//--------- Begin of function FlightRecorder::dump ---------//
+//
+// Writes the records to FLIGHTn.REC in the config directory, n being the
+// player's nation recno so that players on one computer do not overwrite
+// each other's dumps.
+//
+// <const char*> reason - what triggered the dump, kept in the file
+//
+void FlightRecorder::dump(const char* reason)
+{
+	if( dump_flag )
+		return;
+
+	dump_flag = 1;
+
+	//------- prepare the header -------//
+
+	FlightRecordFileHeader fileHeader;
+	uint32_t recordCount = record_count;
+	int siteCount = MIN((int) site_count, (int) MAX_FLIGHT_SITE);
+
+	memset(&fileHeader, 0, sizeof(fileHeader));
+	memcpy(fileHeader.magic, FLIGHT_FILE_MAGIC, sizeof(FLIGHT_FILE_MAGIC));
+	fileHeader.version = FLIGHT_FILE_VERSION;
+	fileHeader.site_count = siteCount;
+	fileHeader.record_count = MIN(recordCount, (uint32_t) MAX_FLIGHT_RECORD);
+	fileHeader.player_nation_recno = nation_array.player_recno;
+	strncpy(fileHeader.reason, reason, sizeof(fileHeader.reason)-1);
+
+	//------- write the file -------//
+
+	FilePath full_path(sys.dir_config);
+	char fileName[20];
+	File file;
+
+	snprintf(fileName, sizeof(fileName), "FLIGHT%d.REC", (int) nation_array.player_recno);
+	full_path += fileName;
+
+	if( full_path.error_flag || !file.file_create(full_path, 0) )		// 0=don't handle error itself
+		return;
+
+	int rc = file.file_write(&fileHeader, sizeof(fileHeader));
+
+	for( int i=0 ; rc && i<siteCount ; i++ )
+	{
+		char siteName[FLIGHT_SITE_NAME_LEN];
+
+		memset(siteName, 0, sizeof(siteName));
+		strncpy(siteName, site_name_array[i], sizeof(siteName)-1);
+
+		rc = file.file_write(siteName, sizeof(siteName));
+	}
+
+	//--- the ring is written from the oldest record, which is the next one to be overwritten ---//
+
+	uint32_t firstSlot = (recordCount - fileHeader.record_count) & (MAX_FLIGHT_RECORD-1);
+	uint32_t tailCount = MIN(fileHeader.record_count, (uint32_t) MAX_FLIGHT_RECORD - firstSlot);
+
+	if( rc && tailCount > 0 )
+		rc = file.file_write(record_array + firstSlot, sizeof(FlightRecord) * tailCount);
+
+	if( rc && fileHeader.record_count > tailCount )
+		rc = file.file_write(record_array, sizeof(FlightRecord) * (fileHeader.record_count - tailCount));
+
+	file.file_close();
+
+	if( rc )
+		MSG("Flight recorder dumped to %s (%s)\n", (const char*) full_path, reason);
+	else
+		ERR("Cannot write %s\n", (const char*) full_path);
+}
+//----------- End of function FlightRecorder::dump -----------//
@@ -36,6 +36,9 @@
 #include <ONATION.h>
 #include <OHELP.h>
 #include <LocaleRes.h>
+#include <OINFOFLD.h>
+#include <OTEXTCAC.h>
+#include <COLCODE.h>
 #include <OFONT.h>
 
 //--------------------------------------------------------//
@@ -226,6 +229,8 @@ void Font::init(const char* fontName, int interCharSpace, int italicShift)
 //
 void Font::deinit()
 {
+	text_cache.clear_font(this);
+
 	if( font_info_array )
 	{
 		mem_del( font_info_array );
@@ -263,6 +268,41 @@ int Font::put(int x,int y,const char* textPtr, char clearBack, int x2 )
 	if( !init_flag )
 		return x;
 
+	//--- draw the whole text at once if it has been drawn before ---//
+
+	if( !clearBack )
+	{
+		TextCacheEntry* entryPtr = text_cache.get_entry(this, textPtr);
+
+		if( entryPtr && entryPtr->span_state == TextCache::SPAN_NONE &&
+			 ++entryPtr->put_count >= 2 )			// only keep an image of a text drawn again
+		{
+			entryPtr->span_bitmap = draw_span( textPtr, entryPtr->span_need_width, entryPtr->span_last_x );
+			entryPtr->span_state  = entryPtr->span_bitmap ? TextCache::SPAN_READY : TextCache::SPAN_CANNOT;
+		}
+
+		if( entryPtr && entryPtr->span_state == TextCache::SPAN_READY )
+		{
+			int spanX2 = MIN( x2<0 ? x+entryPtr->span_need_width : x2, VGA_WIDTH-1 );
+
+			if( x+entryPtr->span_need_width <= spanX2 )		// it is not cut off by x2
+			{
+				int y2 = y+(Ambition::Config::enhancementsAvailable() ? max_font_height : font_height)-1;
+
+				if( !Vga::use_back_buf )
+					mouse.hide_area( x, y, spanX2, y2 );
+
+				IMGbltTrans( Vga::active_buf->buf_ptr(), Vga::active_buf->buf_pitch(),
+					x, y, entryPtr->span_bitmap );
+
+				if( !Vga::use_back_buf )
+					mouse.show_area();
+
+				return x+entryPtr->span_last_x;
+			}
+		}
+	}
+
 #ifdef ENABLE_NLS
 	textPtr = locale_res.conv_str(cd, textPtr);
 #endif
@@ -398,6 +438,115 @@ int Font::put(int x,int y,const char* textPtr, char clearBack, int x2 )
 //----------- End of function Font::put ---------//
 
 
+//--------- Start of function Font::draw_span ---------//
+//
+// Draw the whole text into a new bitmap for IMGbltTrans(), laid out
+// the same as put() does. Called by put() for TextCache.
+//
+// <char*>  textPtr   = the text
+// <short&> needWidth = for returning the room the text needs for
+//                      put() not to cut it off
+// <short&> lastX     = for returning the x offset of the last pixel
+//
+// Return : <char*> the bitmap, NULL if the text cannot be drawn in
+//                  advance
+//
+char* Font::draw_span(const char* textPtr, short& needWidth, short& lastX)
+{
+#ifdef ENABLE_NLS
+	textPtr = locale_res.conv_str(cd, textPtr);
+#endif
+
+	//------ get the size of the text ------//
+
+	const unsigned char* charPtr;
+	FontInfo* fontInfo;
+	int x=0, spanWidth=0, spanHeight=0;
+
+	for( charPtr=(const unsigned char*)textPtr ; *charPtr ; charPtr++, x+=inter_char_space )
+	{
+		if( *charPtr == ' ' )
+		{
+			spanWidth = MAX(spanWidth, x+space_width);
+			x += space_width;
+		}
+		else if( *charPtr == '@' )		// the @COL nation color bar is drawn by NationArray
+		{
+			return NULL;
+		}
+		else if( *charPtr >= first_char && *charPtr <= last_char )
+		{
+			fontInfo = font_info_array + (*charPtr-first_char);
+
+			if( fontInfo->width > 0 )
+			{
+				if( fontInfo->offset_y < 0 )
+					return NULL;
+
+				spanWidth  = MAX(spanWidth, x+fontInfo->width);
+				spanHeight = MAX(spanHeight, fontInfo->offset_y+fontInfo->height);
+				x += fontInfo->width;
+			}
+		}
+		else if( *charPtr == '\t' )
+		{
+			x += space_width*8;
+		}
+		else
+		{
+			x += space_width;
+		}
+	}
+
+	if( spanWidth==0 || spanHeight==0 )
+		return NULL;
+
+	needWidth = spanWidth;
+	lastX = x-1;
+
+	//------- draw the characters -------//
+
+	char* spanBitmap = mem_add( 4 + spanWidth*spanHeight );
+
+	*((short*)spanBitmap)   = spanWidth;
+	*((short*)spanBitmap+1) = spanHeight;
+	memset( spanBitmap+4, TRANSPARENT_CODE, spanWidth*spanHeight );
+
+	x = 0;
+
+	for( charPtr=(const unsigned char*)textPtr ; *charPtr ; charPtr++, x+=inter_char_space )
+	{
+		if( *charPtr == ' ' )
+		{
+			x += space_width;
+		}
+		else if( *charPtr >= first_char && *charPtr <= last_char )
+		{
+			fontInfo = font_info_array + (*charPtr-first_char);
+
+			if( fontInfo->width > 0 )
+			{
+				IMGbltTrans( spanBitmap+4, spanWidth, x, fontInfo->offset_y,
+					font_bitmap_buf + fontInfo->bitmap_offset );
+
+				x += fontInfo->width;
+			}
+		}
+		else if( *charPtr == '\t' )
+		{
+			x += space_width*8;
+		}
+		else
+		{
+			x += space_width;
+		}
+	}
+
+	return spanBitmap;
+}
+//----------- End of function Font::draw_span ---------//
+
+
 //#ifdef GERMAN
 //--------- Start of function Font::translate_german_char ---------//
 //
@@ -465,6 +614,35 @@ void Font::right_put(int x, int y, char* textPtr)
 // Return : <int> the screen width of the textPtr display using this font
 //
 int Font::text_width(const char* textPtr, int textPtrLen, int maxDispWidth)
+{
+	if( !init_flag || textPtrLen >= 0 || maxDispWidth || !textPtr[0] )
+		return calc_text_width(textPtr, textPtrLen, maxDispWidth);
+
+	//------ the width of a whole text is kept in TextCache ------//
+
+	TextCacheEntry* entryPtr = text_cache.get_entry(this, textPtr);
+
+	if( !entryPtr )
+		return calc_text_width(textPtr, textPtrLen, maxDispWidth);
+
+	if( entryPtr->text_width < 0 )
+	{
+		entryPtr->text_width = calc_text_width(textPtr, textPtrLen, maxDispWidth);
+		entryPtr->line_count = text_line_count;
+	}
+
+	text_line_count = entryPtr->line_count;
+
+	return entryPtr->text_width;
+}
+//----------- End of function Font::text_width ----//
+
+
+//--------- Begin of function Font::calc_text_width ----//
+//
+// Calculate the width for text_width().
+//
+int Font::calc_text_width(const char* textPtr, int textPtrLen, int maxDispWidth)
 {
 	int   charWidth, x=0, lenCount, maxLen=0, wordWidth=0;
 	short textChar;
@@ -563,7 +741,7 @@ int Font::text_width(const char* textPtr, int textPtrLen, int maxDispWidth)
 
 	return MAX(maxLen,x);
 }
-//----------- End of function Font::text_width ----//
+//----------- End of function Font::calc_text_width ----//
 
 
 //--------- Begin of function Font::text_height ----//
@@ -1056,6 +1234,7 @@ void Font::update_field(int x1, int y1, int value, int format, int x2)
 void Font::field(int xDes, int y1, const char* desStr, int xValue, int value,
 					  int format, int xEnd, int refreshFlag, const char* helpCode)
 {
+	const char* valueStr = misc.format(value,format);
 	int x2;
 
 	if( refreshFlag == INFO_REPAINT )
@@ -1063,11 +1242,13 @@ void Font::field(int xDes, int y1, const char* desStr, int xValue, int value,
 		vga_util.d3_panel_up( xDes, y1, xValue, y1+font_height+3 );
 
 		put( xDes+2  , y1+2, desStr);
-		x2 = put( xValue+4, y1+2, misc.format(value,format) );
+		x2 = put( xValue+4, y1+2, valueStr );
+		info_field_cache.set_field( this, xValue, y1, valueStr, x2 );
 	}
-	else
+	else if( !info_field_cache.get_field(this, xValue, y1, valueStr, x2) )		// only draw it again if the value has changed
 	{
-		x2 = put( xValue+4, y1+2, misc.format(value,format), 1, xEnd );
+		x2 = put( xValue+4, y1+2, valueStr, 1, xEnd );
+		info_field_cache.set_field( this, xValue, y1, valueStr, x2 );
 	}
 
 	if( helpCode )
@@ -1150,18 +1331,21 @@ void Font::update_field(int x1, int y1, double value, int format, int x2)
 void Font::field(int xDes, int y1, const char* desStr, int xValue, double value,
 					  int format, int xEnd, int refreshFlag, char* helpCode )
 {
+	const char* valueStr = misc.format(value,format);
 	int x2;
 
-   if( refreshFlag == INFO_REPAINT )
-   {
+	if( refreshFlag == INFO_REPAINT )
+	{
 		vga_util.d3_panel_up( xDes, y1, xValue, y1+font_height+3 );
 
-      put( xDes+2  , y1+2, desStr);
-      x2 = put( xValue+4, y1+2, misc.format(value,format) );
-   }
-   else
-   {
-		x2 = put( xValue+4, y1+2, misc.format(value,format), 1, xEnd );
+		put( xDes+2  , y1+2, desStr);
+		x2 = put( xValue+4, y1+2, valueStr );
+		info_field_cache.set_field( this, xValue, y1, valueStr, x2 );
+	}
+	else if( !info_field_cache.get_field(this, xValue, y1, valueStr, x2) )		// only draw it again if the value has changed
+	{
+		x2 = put( xValue+4, y1+2, valueStr, 1, xEnd );
+		info_field_cache.set_field( this, xValue, y1, valueStr, x2 );
 	}
 
 	if( helpCode )
@@ -1237,10 +1421,12 @@ void Font::field(int xDes, int y1, const char* desStr, int xValue, const char* v
 
 		put( xDes+2  , y1+2, desStr);
 		x2 = put( xValue+4, y1+2, value );
+		info_field_cache.set_field( this, xValue, y1, value, x2 );
 	}
-	else
+	else if( !info_field_cache.get_field(this, xValue, y1, value, x2) )		// only draw it again if the value has changed
 	{
 		x2 = put( xValue+4, y1+2, value, 1, xEnd );
+		info_field_cache.set_field( this, xValue, y1, value, x2 );
 	}
 
 	if( helpCode )
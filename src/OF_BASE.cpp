@@ -37,6 +37,7 @@
 #include <OF_BASE.h>
 #include <OREMOTE.h>
 #include <OSE.h>
+#include <OSPRLOAD.h>
 #include "gettext.h"
 
 //----------- Define static vars -------------//
@@ -457,6 +458,11 @@ void FirmBase::next_day()
 			pray_points = (float) MAX_PRAY_POINTS;
 	}
 
+	//--- read the god's bitmaps once it has enough points to be invoked ---//
+
+	if( !god_unit_recno && overseer_recno && pray_points >= MAX_PRAY_POINTS/10 )
+		sprite_loader.prefetch_unit( god_res[god_id]->unit_id );
+
 	//------ validate god_unit_recno ------//
 
 	if( god_unit_recno )
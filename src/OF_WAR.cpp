@@ -41,6 +41,7 @@
 #include <OREMOTE.h>
 #include <OSE.h>
 #include <OSERES.h>
+#include <OSPRLOAD.h>
 #include <OBUTTCUS.h>
 #include "gettext.h"
 
@@ -939,6 +940,8 @@ void FirmWar::process_queue()
 
 	nationPtr->add_expense( EXPENSE_WEAPON, unit_res[build_unit_id]->build_cost, 1);
 
+	sprite_loader.prefetch_unit( build_unit_id );		// read the weapon's bitmaps while it is being built
+
 	err_when( build_queue_count > MAX_BUILD_QUEUE );
 
 	misc.del_array_rec( build_queue_array, build_queue_count, sizeof(build_queue_array[0]), 1 );
@@ -38,6 +38,7 @@
 #include <OMONSRES.h>
 #include <OTOWN.h>
 #include <OTownNetwork.h>
+#include <ONATVIEW.h>
 #include <ONATION.h>
 #include <OFIRM.h>
 #include <OIMGRES.h>
@@ -67,6 +68,13 @@
 // ##### begin Gilbert 2/10 #######//
 #include <OFIRMDIE.h>
 // ##### end Gilbert 2/10 #######//
+#include <OFLTREC.h>
+#include <OMPRESYN.h>
+#include <OMEMSTAT.h>
+#include <ORENDSNP.h>
+#include <ORESBAKE.h>
+#include <OSPRLOAD.h>
+#include <OINITGRF.h>
 
 //---------------- DETECT_SPREAD ----------------//
 //
@@ -108,6 +116,8 @@ int Game::init(int loadGameCall)
    if( init_flag )
 		deinit();
 
+	MemStat::start_leak_check();
+
 	int originalRandomSeed = misc.get_random_seed();
 
 	music.stop();
@@ -122,31 +132,43 @@ int Game::init(int loadGameCall)
 
 	char tpictFile[] = DIR_RES"I_TPICT?.RES";
 	*(strstr( tpictFile, "?")) = '0' + config.terrain_set;
-	image_tpict.init(tpictFile,1,0);		// config.terrain_set dependent, must load before town_res.init and terrain_res.init
-	terrain_res.init();
-	plant_res.init();
-	tech_res.init();
-	god_res.init();
-
-	sprite_res.init();                              // sprite resource object must been initialized after game_set as it relies on game_set for info.
-	sprite_frame_res.init();
-	unit_res.init();
-   monster_res.init();
-
-	raw_res.init();
-	race_res.init();
-	firm_res.init();
-	// ##### begin Gilbert 2/10 #######//
-	firm_die_res.init();
-	// ##### end Gilbert 2/10 #######//
-	town_res.init();
-	hill_res.init();
-	snow_res.init();
-	rock_res.init();
-	explored_mask.init(vga.vga_color_table);
-   se_res.init1();
-	se_res.init2(&se_ctrl);
-	talk_res.init();
+
+	std::string terrainSet = std::to_string( (int) config.terrain_set );
+	InitGraph initGraph("Game::init");
+
+	// the files given are read in whole by the inits, they are read ahead while the inits run.
+	// Only the inits flagged 1 run on worker threads, the others use misc.atoi()'s buffer or game_set.
+
+	int tpictStep   = initGraph.add_step( "image_tpict", [&]() { image_tpict.init(tpictFile,1,0); }, {}, { tpictFile }, 1 );		// config.terrain_set dependent, must load before town_res.init and terrain_res.init
+	int terrainStep = initGraph.add_step( "terrain_res", []() { terrain_res.init(); }, { tpictStep },
+							{ DIR_RES"I_TERN"+terrainSet+".RES", DIR_RES"I_TERA"+terrainSet+".RES" } );
+	initGraph.add_step( "plant_res", []() { plant_res.init(); }, { terrainStep }, { DIR_RES"I_PLANT"+terrainSet+".RES" } );
+	int techStep    = initGraph.add_step( "tech_res", []() { tech_res.init(); }, {}, { DIR_RES"I_TECH.RES" } );
+	initGraph.add_step( "god_res", []() { god_res.init(); } );
+
+	int spriteStep  = initGraph.add_step( "sprite_res", []() { sprite_res.init(); } );		// sprite resource object must been initialized after game_set as it relies on game_set for info.
+	int frameStep   = initGraph.add_step( "sprite_frame_res", []() { sprite_frame_res.init(); } );
+	int unitStep    = initGraph.add_step( "unit_res", []() { unit_res.init(); }, { spriteStep },
+							{ DIR_RES"I_UNITLI.RES", DIR_RES"I_UNITGI.RES", DIR_RES"I_UNITKI.RES",
+							  DIR_RES"I_UNITSI.RES", DIR_RES"I_UNITTI.RES", DIR_RES"I_UNITUI.RES" } );
+	initGraph.add_step( "monster_res", []() { monster_res.init(); }, { unitStep } );
+
+	initGraph.add_step( "raw_res", []() { raw_res.init(); }, {}, { DIR_RES"I_RAW.RES" } );
+	int raceStep    = initGraph.add_step( "race_res", []() { race_res.init(); }, { unitStep }, { DIR_RES"I_RACE.RES" } );
+	int firmStep    = initGraph.add_step( "firm_res", []() { firm_res.init(); }, {}, { DIR_RES"I_FIRM.RES" } );
+	initGraph.add_step( "firm_die_res", []() { firm_die_res.init(); }, { firmStep } );
+	int townStep    = initGraph.add_step( "town_res", []() { town_res.init(); }, { tpictStep, raceStep }, { DIR_RES"I_TOWN.RES" } );
+	initGraph.add_step( "hill_res", []() { hill_res.init(); }, {}, { DIR_RES"I_HILL"+terrainSet+".RES" } );
+	initGraph.add_step( "snow_res", []() { snow_res.init(); }, {}, { DIR_RES"I_SNOW.RES" } );
+	initGraph.add_step( "rock_res", []() { rock_res.init(); }, {}, { DIR_RES"I_ROCK"+terrainSet+".RES" } );
+	initGraph.add_step( "explored_mask", []() { explored_mask.init(vga.vga_color_table); }, {},
+							{ DIR_RES"EXPLMASK.BIN", DIR_RES"EXPREMAP.BIN" }, 1 );
+	initGraph.add_step( "se_res", []() { se_res.init1(); se_res.init2(&se_ctrl); } );
+	initGraph.add_step( "talk_res", []() { talk_res.init(); }, { techStep } );
+
+	initGraph.add_step( "res_bake", []() { res_bake.save(); }, { frameStep, raceStep, townStep } );		// keep the tables parsed above for the next time
+
+	initGraph.run();
 
 	//------- init game data class ---------//
 
@@ -157,6 +179,7 @@ int Game::init(int loadGameCall)
 	// ##### end Gilbert 2/10 #######//
 	town_array.init();
 	town_network_array.init();
+	nation_view_array.init();
 	unit_array.init();
 	bullet_array.init();
 	rebel_array.init();
@@ -167,6 +190,8 @@ int Game::init(int loadGameCall)
 	effect_array.init();
 	tornado_array.init();
 	war_point_array.init();
+	flight_recorder.init();
+	mp_resync.init();
 
    //------ init game surface class ----------//
 
@@ -259,6 +284,7 @@ void Game::deinit(int loadGameCall)
 	town_network_array.deinit();
 	town_array.deinit();
 	unit_array.deinit();
+	render_snapshot.deinit();
 	bullet_array.deinit();
 	rebel_array.deinit();
 	spy_array.deinit();
@@ -269,6 +295,7 @@ void Game::deinit(int loadGameCall)
 	effect_array.deinit();
 	tornado_array.deinit();
 	war_point_array.deinit();
+	nation_view_array.deinit();
 
 	//------ deinit game surface class -------//
 
@@ -288,6 +315,7 @@ void Game::deinit(int loadGameCall)
 	god_res.deinit();
 	monster_res.deinit();
 
+	sprite_loader.deinit();		// before sprite_res as it keeps pointers to SpriteInfo
 	sprite_res.deinit();
 	sprite_frame_res.deinit();
 	unit_res.deinit();
@@ -312,6 +340,10 @@ void Game::deinit(int loadGameCall)
 
 	mouse_cursor.restore_icon(oldCursor);
 
+	//------ report memory kept after the game -------//
+
+	MemStat::end_leak_check();
+
 	init_flag=0;
 }
 //--------- End of function Game::deinit ---------//
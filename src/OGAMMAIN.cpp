@@ -35,6 +35,7 @@
 #include <OTUTOR.h>
 #include <OBATTLE.h>
 #include <OSaveGameArray.h>
+#include <OSaveGameIndex.h>
 #include <OGAMHALL.h>
 #include <OMUSIC.h>
 #include <OGAME.h>
@@ -106,6 +107,10 @@ void Game::main_menu()
 	char *darkBitmap = NULL;
 	int pointingOption = -1;
 
+	//--- scan the savegames while the player is in the menu, so the load menu opens quickly ---//
+
+	save_game_index.prefetch("*.SAV");
+
 	while(1)
 	{
 		game_mode = GAME_PREGAME;
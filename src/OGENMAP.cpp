@@ -23,6 +23,7 @@
 //Ownership   : Gilbert
 
 #include <stdlib.h>
+#include <vector>
 
 #include <ALL.h>
 #include <OGAME.h>
@@ -32,22 +33,36 @@
 #include <OPLASMA.h>
 #include <OREGION.h>
 #include <OFIRMID.h>
+#include <dbglog.h>
+
+DBGLOG_DEFAULT_CHANNEL(GenMap);
+
+//------- Define constant -------//
+
+enum { MAX_GEN_MAP_STEPS = 14 };
+
+//------- Define static variables -------//
+
+static int           gen_map_step;			// the no. of steps finished
+static unsigned long gen_map_step_time;	// the time the current step started
+
+//------- Declare static functions -------//
+
+static void disp_gen_map_step();
+static void end_gen_map_step(const char* stepName);
+
 
 //-------- Begin of function World::generate_map ----------//
 //
 void World::generate_map()
 {
-	const int dispProgress = 1;
-	const int maxGenMapSteps = 14;
 	vga_front.unlock_buf();
 
-	int curGenMapSteps = 0;
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	unsigned long startTime = misc.get_time();
+
+	gen_map_step = 0;
+	gen_map_step_time = startTime;
+	disp_gen_map_step();
 
 	//--- loc_matrix, first store terrain height, then world map icon id ---//
 
@@ -89,13 +104,7 @@ void World::generate_map()
 	heightMap.init(max_x_loc, max_y_loc);
 	heightMap.generate( misc.random(2), 5, misc.rand() );
 
-	curGenMapSteps++;			// 1
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	end_gen_map_step("plasma");
 
 	// ###### begin Gilbert 27/8 ########//
 	// ---------- add base level --------//
@@ -166,13 +175,7 @@ void World::generate_map()
 		heightMap.add_base_level(initHeightLimit - heightLimit[1]);
 	}
 
-	curGenMapSteps++;			// 2
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	end_gen_map_step("land mass");
 	// ###### end Gilbert 27/8 ########//
 
 	// --------- remove odd terrain --------//
@@ -183,13 +186,7 @@ void World::generate_map()
 		remove_odd(heightMap, x, y, 5);
 	}
 
-	curGenMapSteps++;			// 3
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	end_gen_map_step("remove odd");
 
 	// ------------ shuffle sub-terrain level ---------//
 
@@ -202,108 +199,42 @@ void World::generate_map()
 	heightMap.shuffle_level(TerrainRes::min_height(TERRAIN_DARK_DIRT), 
 		TerrainRes::max_height(TERRAIN_DARK_DIRT), 3 );
 
-	curGenMapSteps++;			// 4
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	end_gen_map_step("shuffle level");
 
 	set_tera_id(heightMap);
-	curGenMapSteps++;			// 5
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	end_gen_map_step("terrain id");
 
 	substitute_pattern();
-	curGenMapSteps++;			// 6
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	end_gen_map_step("substitute pattern");
 
 	set_loc_flags();
 
 	//--------- assign the map --------//
 
 	assign_map();
-	curGenMapSteps++;			// 7
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	end_gen_map_step("assign map");
 
 	gen_hills(TERRAIN_DARK_DIRT);
-	curGenMapSteps++;			// 8
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	end_gen_map_step("hills");
 
 	set_region_id();
-	curGenMapSteps++;			// 9
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	end_gen_map_step("region id");
 
 
 	gen_dirt(40,30,60);
-	curGenMapSteps++;			// 10
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	end_gen_map_step("dirt");
 
 	gen_rocks(5,10,30);
-	curGenMapSteps++;		// 11
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	end_gen_map_step("rocks");
 
 	set_harbor_bit();
-	curGenMapSteps++;		// 12
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	end_gen_map_step("harbor bit");
 
 	plant_init();
-	curGenMapSteps++;		// 13
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	end_gen_map_step("plants");
 
 	init_fire();
-	curGenMapSteps++;		// 14
-	if( dispProgress )
-	{
-		vga_front.lock_buf();
-		game.disp_gen_map_status( curGenMapSteps, maxGenMapSteps, 0 );
-		vga_front.unlock_buf();
-	}
+	end_gen_map_step("fire");
 
 /*
 	// randomly put a fire
@@ -320,6 +251,8 @@ void World::generate_map()
 	} while(1);
 */
 
+	MSG("%dx%d map generated in %lu ms\n", max_x_loc, max_y_loc, misc.get_time()-startTime);
+
 	vga_front.lock_buf();
 
 	//----- debug code: validate terrain_id -----//
@@ -340,34 +273,101 @@ void World::generate_map()
 //---------- End of function World::generate_map ------------//
 
 
+//-------- Begin of static function disp_gen_map_step ----------//
+//
+static void disp_gen_map_step()
+{
+	vga_front.lock_buf();
+	game.disp_gen_map_status( gen_map_step, MAX_GEN_MAP_STEPS, 0 );
+	vga_front.unlock_buf();
+}
+//---------- End of static function disp_gen_map_step ------------//
+
+
+//-------- Begin of static function end_gen_map_step ----------//
+//
+// Log the time taken by the step just finished and advance the
+// progress bar.
+//
+static void end_gen_map_step(const char* stepName)
+{
+	unsigned long curTime = misc.get_time();
+
+	MSG("step %2d %-20s %5lu ms\n", gen_map_step+1, stepName, curTime-gen_map_step_time);
+
+	gen_map_step++;
+	gen_map_step_time = curTime;
+
+	err_when( gen_map_step > MAX_GEN_MAP_STEPS );
+
+	disp_gen_map_step();
+}
+//---------- End of static function end_gen_map_step ------------//
+
+
 //---------- Begin of function World::set_tera_id -----------//
 //
 // Set terrain icon id
 //
+// Each plasma point is converted to a 4-bit terrain code once, and the
+// first terrain matching four corner codes is looked up in the resource
+// only once. A random alternative of it is then picked for each location,
+// drawing from misc.random() exactly as terrain_res.scan() would.
+//
 void World::set_tera_id(Plasma &plasma)
 {
 	//------- create a world map based on the terrain map ------//
 
 	memset(loc_matrix, 0, sizeof(Location)*max_x_loc*max_y_loc);
 
+	//---- get the terrain type and sub-type of each plasma point ----//
+
+	int pixWidth = plasma.max_x+1;
+	std::vector<unsigned char> pixCode( pixWidth*(plasma.max_y+1) );
+
+	for( int i = 0; i < (int) pixCode.size(); ++i)
+	{
+		int subType;
+		int type = TerrainRes::terrain_height(plasma.matrix[i], &subType);
+
+		pixCode[i] = ((type-1) << 2) | (subType >> 1);		// subType is 1, 2 or 4
+	}
+
+	//---- terrain id of the first match, -1 if not yet scanned ----//
+
+	std::vector<short> firstTerrainId( 1 << 16, -1 );
+
 	for( int y = 0; y < max_y_loc; ++y)
 	{
-		for( int x = 0; x < max_x_loc; ++x)
+		const unsigned char* pixRow = &pixCode[y*pixWidth];
+		Location* locPtr = get_loc(0,y);
+
+		for( int x = 0; x < max_x_loc; ++x, ++locPtr)
 		{
-			int nwType, neType, swType, seType;
-			int nwSubType, neSubType, swSubType, seSubType;
-			nwType = TerrainRes::terrain_height(plasma.get_pix(x,y), &nwSubType);
-			neType = TerrainRes::terrain_height(plasma.get_pix(x+1,y), &neSubType);
-			swType = TerrainRes::terrain_height(plasma.get_pix(x,y+1), &swSubType);
-			seType = TerrainRes::terrain_height(plasma.get_pix(x+1,y+1), &seSubType);
-
-			if((get_loc(x,y)->terrain_id = terrain_res.scan( nwType, nwSubType,
-				neType, neSubType, swType, swSubType, seType, seSubType ,0,1,0)) == 0)
+			int cornerCode = (pixRow[x] << 12) | (pixRow[x+1] << 8) |
+				(pixRow[pixWidth+x] << 4) | pixRow[pixWidth+x+1];
+
+			short& terrainId = firstTerrainId[cornerCode];
+
+			if( terrainId < 0 )
+			{
+				terrainId = terrain_res.scan( (pixRow[x]>>2)+1, 1<<(pixRow[x]&3),
+					(pixRow[x+1]>>2)+1, 1<<(pixRow[x+1]&3),
+					(pixRow[pixWidth+x]>>2)+1, 1<<(pixRow[pixWidth+x]&3),
+					(pixRow[pixWidth+x+1]>>2)+1, 1<<(pixRow[pixWidth+x+1]&3), 1,1,0);
+			}
+
+			if( terrainId == 0 )
 			{
 				err.run("Error World::set_tera_id, Cannot find terrain type %d:%d, %d:%d, %d:%d, %d:%d",
-					nwType, nwSubType, neType, neSubType, swType, swSubType,
-					seType, seSubType);
+					(pixRow[x]>>2)+1, 1<<(pixRow[x]&3),
+					(pixRow[x+1]>>2)+1, 1<<(pixRow[x+1]&3),
+					(pixRow[pixWidth+x]>>2)+1, 1<<(pixRow[pixWidth+x]&3),
+					(pixRow[pixWidth+x+1]>>2)+1, 1<<(pixRow[pixWidth+x+1]&3));
 			}
+
+			locPtr->terrain_id = terrainId +
+				misc.random(terrain_res[terrainId]->alternative_count_with_extra+1);
 		}
 	}
 }
@@ -571,20 +571,36 @@ void World::remove_odd(Plasma &plasma, short x, short y, short recur)
 
 
 //---------- Begin of function World::substitute_pattern -----//
+//
+// The substitutions starting with each pattern are searched only the
+// first time the pattern is met.
+//
 void World::substitute_pattern()
 {
 	short terrainId;
 	int SubFound;
 	const unsigned int resultArraySize = 20;
-	TerrainSubInfo *candSub[resultArraySize];
+	const int patternCount = 256;			// pattern_id is a char
+	TerrainSubInfo *candSubArray[patternCount][resultArraySize];
+	short candSubCount[patternCount];
+
+	for( int i = 0; i < patternCount; ++i)
+		candSubCount[i] = -1;
 
 	for( short y = 0; y < max_y_loc; ++y)
 	{
 		for( short x = 0; x < max_x_loc; ++x)
 		{
 			terrainId = get_loc(x,y)->terrain_id;
-			SubFound = terrain_res.search_pattern(
-				terrain_res[terrainId]->pattern_id, candSub, resultArraySize);
+
+			char patternId = terrain_res[terrainId]->pattern_id;
+			unsigned char cacheIndex = (unsigned char) patternId;
+			TerrainSubInfo **candSub = candSubArray[cacheIndex];
+
+			if( candSubCount[cacheIndex] < 0 )
+				candSubCount[cacheIndex] = terrain_res.search_pattern(patternId, candSub, resultArraySize);
+
+			SubFound = candSubCount[cacheIndex];
 			for( int i = 0; i < SubFound; ++i)
 			{
 				short tx = x, ty = y;
@@ -656,8 +672,14 @@ void World::substitute_pattern()
 
 //---------- Begin of function World::set_region_id -----//
 // must be called before any mountain or buildings on the map
-static RegionType walkable;					// to save stack space
+struct FillSeed
+{
+	short x, y;
+};
+
+static RegionType walkable;					// shared with fill_region()
 static unsigned char regionId;
+static std::vector<FillSeed> fill_stack;	// pending seeds of fill_region()
 void World::set_region_id()
 {
 	int            i,x,y;
@@ -750,48 +772,67 @@ void World::set_region_id()
 
 
 //---------- Begin of function World::fill_region -----//
+//
+// Give regionId to all locations of type walkable that are connected to
+// (x,y), including diagonally. The fill works on whole rows and keeps its
+// pending seeds in fill_stack instead of recursing, so the depth does not
+// grow with the size of the map.
+//
 void World::fill_region(short x, short y)
 {
 	err_when( x < 0 || x >= max_x_loc || y < 0 || y >= max_y_loc);
 
-	short left, right;
-	// Location *locPtr;
+	fill_stack.clear();
+	fill_stack.push_back( FillSeed{x, y} );
 
-	// extent x to left and right
-	for( left = x; left >= 0 && !get_loc(left,y)->region_id && get_loc(left,y)->region_type() == walkable; --left)
+	while( !fill_stack.empty() )
 	{
-		get_loc(left,y)->region_id = regionId;
-	}
-	++left;
+		x = fill_stack.back().x;
+		y = fill_stack.back().y;
+		fill_stack.pop_back();
 
-	for( right=x+1; right < max_x_loc && !get_loc(right,y)->region_id && get_loc(right,y)->region_type() == walkable; ++right)
-	{
-		get_loc(right,y)->region_id = regionId;
-	}
-	--right;
+		Location* rowPtr = get_loc(0,y);
 
-	// ------- scan line below ---------//
-	y++;
-	if( y < max_y_loc )
-	{
-		for( x = left>0?left-1:0 ; x <= right+1 && x < max_x_loc; ++x )
+		if( rowPtr[x].region_id || rowPtr[x].region_type() != walkable )
+			continue;			// filled since it was pushed
+
+		short left, right;
+
+		// extent x to left and right
+		for( left = x; left >= 0 && !rowPtr[left].region_id && rowPtr[left].region_type() == walkable; --left)
 		{
-			if( !get_loc(x,y)->region_id && get_loc(x,y)->region_type() == walkable)
-			{
-				fill_region(x,y);
-			}
+			rowPtr[left].region_id = regionId;
 		}
-	}
+		++left;
 
-	// ------- scan line above -------- //
-	y -= 2;
-	if( y >= 0)
-	{
-		for( x = left>0?left-1:0 ; x <= right+1 && x < max_x_loc; ++x )
+		for( right=x+1; right < max_x_loc && !rowPtr[right].region_id && rowPtr[right].region_type() == walkable; ++right)
 		{
-			if( !get_loc(x,y)->region_id && get_loc(x,y)->region_type() == walkable)
+			rowPtr[right].region_id = regionId;
+		}
+		--right;
+
+		// ------- seed the lines below and above ---------//
+
+		for( short scanY = y+1; scanY >= y-1; scanY -= 2 )
+		{
+			if( scanY < 0 || scanY >= max_y_loc )
+				continue;
+
+			Location* scanPtr = get_loc(0,scanY);
+			char inRun = 0;
+
+			for( short scanX = left>0?left-1:0 ; scanX <= right+1 && scanX < max_x_loc; ++scanX )
 			{
-				fill_region(x,y);
+				if( !scanPtr[scanX].region_id && scanPtr[scanX].region_type() == walkable)
+				{
+					if( !inRun )		// one seed fills the whole run
+						fill_stack.push_back( FillSeed{scanX, scanY} );
+					inRun = 1;
+				}
+				else
+				{
+					inRun = 0;
+				}
 			}
 		}
 	}
@@ -22,14 +22,17 @@
 //Description : Object Game file, save game and restore game
 
 #include <stdio.h>
+#include <sstream>
 
 #include "ambition/7kaaInterface/serialisation.hh"
 
 #include <OGFILE.h>
 #include <OFILE.h>
+#include <OLZW.h>
 #include <OTALKRES.h>
 #include <OGAME.h>
 #include <OTownNetwork.h>
+#include <ONATVIEW.h>
 #include <OINFO.h>
 #include <OSYS.h>
 #include <OAUDIO.h>
@@ -43,7 +46,7 @@ DBGLOG_DEFAULT_CHANNEL(GameFile);
 #pragma pack(1)
 struct GameFile::SaveGameHeader
 {
-	uint32_t class_size;    // for version compare
+	uint32_t class_size;    // for version compare, COMPRESSED_FLAG is set if the game data is compressed
 	SaveGameInfo info;
 };
 #pragma pack()
@@ -52,6 +55,15 @@ typedef GameFile::SaveGameHeader SaveGameHeader;
 enum {CLASS_SIZE = 302};
 static_assert(sizeof(SaveGameHeader) == CLASS_SIZE, "Savegame header size mismatch"); // (no packing)
 
+//------- the game data after the header is compressed with Lzw ------//
+//
+// <int32_t> size of the game data, <int32_t> size of the compressed data
+// in bits, followed by the compressed data. Games saved before this have
+// no COMPRESSED_FLAG and the game data follows the header as it is.
+//
+enum { COMPRESSED_FLAG = 0x80000000,
+		 LZW_BUF_MARGIN = 256 };		// Lzw reads and writes beyond the data, an unsigned long at a time
+
 enum { ERROR_NONE = 0,
 	ERROR_CREATE,
 	ERROR_WRITE_HEADER,
@@ -85,22 +97,7 @@ bool GameFile::save_game(const char* filePath, const SaveGameInfo& saveGameInfo)
 		fileOpened = true;
 
 	if( rc )
-	{
-		save_process();      // process game data before saving the game
-
-		rc = write_game_header(saveGameInfo, &file);    // write saved game header information
-
-		if( !rc )
-			last_status = ERROR_WRITE_HEADER;
-
-		if( rc )
-		{
-			rc = write_file(&file);
-
-			if( !rc )
-				last_status = ERROR_WRITE_DATA;
-		}
-	}
+		rc = write_game(saveGameInfo, &file);
 
 	file.file_close();
 
@@ -118,6 +115,84 @@ bool GameFile::save_game(const char* filePath, const SaveGameInfo& saveGameInfo)
 //--------- End of function GameFile::save_game --------//
 
 
+//-------- Begin of function GameFile::save_game_mem --------//
+//
+// Saves the current game into a memory file, with the Ambition data
+// after the game data as in a saved game file.
+//
+// <File*> filePtr - memory file created with file_create_mem(0, 1)
+//
+// On error, returns false.
+//
+bool GameFile::save_game_mem(File* filePtr, const SaveGameInfo& saveGameInfo)
+{
+	last_status = ERROR_NONE;
+
+	int rc = write_game(saveGameInfo, filePtr);
+
+	if( rc )
+	{
+		std::ostringstream ambitionData;
+
+		Ambition::Serialisation::saveGame(ambitionData);
+
+		std::string dataStr = ambitionData.str();
+
+		File::FileType fileType = filePtr->file_type;
+		filePtr->file_type = File::FLAT;
+
+		rc = dataStr.empty() || filePtr->file_write((void*) dataStr.data(), dataStr.size());
+
+		filePtr->file_type = fileType;
+
+		if( !rc )
+			last_status = ERROR_WRITE_DATA;
+	}
+
+	return rc != 0;
+}
+//--------- End of function GameFile::save_game_mem --------//
+
+
+//-------- Begin of function GameFile::write_game --------//
+//
+// Writes the header and the compressed game data of the current game.
+//
+// return : <int> 1 - written successfully
+//                0 - not written, last_status is set
+//
+int GameFile::write_game(const SaveGameInfo& saveGameInfo, File* filePtr)
+{
+	save_process();      // process game data before saving the game
+
+	int rc = write_game_header(saveGameInfo, filePtr);    // write saved game header information
+
+	if( !rc )
+	{
+		last_status = ERROR_WRITE_HEADER;
+		return 0;
+	}
+
+	//--- write the game data to memory first and compress it as a whole ---//
+
+	File gameDataFile;
+
+	rc = gameDataFile.file_create_mem(0, 1);
+
+	if( rc )
+		rc = write_file(&gameDataFile);
+
+	if( rc )
+		rc = write_compressed(&gameDataFile, filePtr);
+
+	if( !rc )
+		last_status = ERROR_WRITE_DATA;
+
+	return rc;
+}
+//--------- End of function GameFile::write_game --------//
+
+
 //-------- Begin of function GameFile::load_game --------//
 //
 // return : <int> 1 - loaded successfully.
@@ -137,17 +212,104 @@ int GameFile::load_game(const char* filePath, SaveGameInfo* /*out*/ saveGameInfo
 		last_status = ERROR_OPEN;
 	}
 
-	//-------- read in the GameFile class --------//
-
 	SaveGameHeader saveGameHeader;
+
 	if( rc )
+		rc = read_game(&file, &saveGameHeader);
+
+	const auto position = file.file_pos();
+
+	file.file_close();
+
+	Ambition::Serialisation::loadGame(filePath, position);
+
+	//---------------------------------------//
+
+	if (rc > 0)
 	{
-		if( !file.file_read(&saveGameHeader, CLASS_SIZE) )	// read the whole object from the saved game file
+		*saveGameInfo = saveGameHeader.info;
+		strncpy(scenario_file_name, saveGameInfo->file_name, FilePath::MAX_FILE_PATH);
+		scenario_file_name[FilePath::MAX_FILE_PATH] = 0;
+	}
+
+	return rc;
+}
+//--------- End of function GameFile::load_game --------//
+
+
+//-------- Begin of function GameFile::load_game_mem --------//
+//
+// Loads a game saved into a memory file by save_game_mem().
+//
+// <File*> filePtr - memory file opened with file_open_mem(..., 0, 1)
+//
+// return : <int> 1 - loaded successfully.
+//                0 - not loaded.
+//               -1 - error and partially loaded
+//
+int GameFile::load_game_mem(File* filePtr, SaveGameInfo* /*out*/ saveGameInfo)
+{
+	SaveGameHeader saveGameHeader;
+
+	last_status = ERROR_NONE;
+
+	int rc = read_game(filePtr, &saveGameHeader);
+
+	if( rc > 0 )
+	{
+		long position = filePtr->file_pos();
+		std::istringstream ambitionData( std::string(filePtr->file_mem_buf()+position, filePtr->file_size()-position) );
+
+		Ambition::Serialisation::loadGame(ambitionData);
+
+		*saveGameInfo = saveGameHeader.info;
+		strncpy(scenario_file_name, saveGameInfo->file_name, FilePath::MAX_FILE_PATH);
+		scenario_file_name[FilePath::MAX_FILE_PATH] = 0;
+	}
+
+	return rc;
+}
+//--------- End of function GameFile::load_game_mem --------//
+
+
+//-------- Begin of function GameFile::read_game --------//
+//
+// Reads the header and the game data and replaces the current game
+// with it. The file is left after the game data.
+//
+// return : <int> 1 - loaded successfully.
+//                0 - not loaded, last_status is set
+//               -1 - error and partially loaded
+//
+int GameFile::read_game(File* filePtr, SaveGameHeader* saveGameHeader)
+{
+	int rc=1;
+
+	//-------- read in the GameFile class --------//
+
+	if( !filePtr->file_read(saveGameHeader, CLASS_SIZE) )	// read the whole object from the saved game file
+	{
+		rc = 0;
+		last_status = ERROR_FILE_HEADER;
+	}
+	else if( !validate_header(saveGameHeader) )
+	{
+		rc = 0;
+		last_status = ERROR_FILE_FORMAT;
+	}
+
+	//---- expand compressed game data before the current game is closed ----//
+
+	File gameDataFile;
+	File* gameDataFilePtr = filePtr;
+
+	if( rc && (saveGameHeader->class_size & COMPRESSED_FLAG) )
+	{
+		if( read_compressed(filePtr, &gameDataFile) )
 		{
-			rc = 0;
-			last_status = ERROR_FILE_HEADER;
+			gameDataFilePtr = &gameDataFile;
 		}
-		else if( !validate_header(&saveGameHeader) )
+		else
 		{
 			rc = 0;
 			last_status = ERROR_FILE_FORMAT;
@@ -158,14 +320,14 @@ int GameFile::load_game(const char* filePath, SaveGameInfo* /*out*/ saveGameInfo
 																  // 1=allow the writing size and the read size to be different
 	if( rc )
 	{
-		config.terrain_set = saveGameHeader.info.terrain_set;
+		config.terrain_set = saveGameHeader->info.terrain_set;
 
 		game.deinit(1);		// deinit last game first, 1-it is called during loading of a game
 		game.init(1);			// init game
 
 		//-------- read in saved game ----------//
 
-		switch( read_file(&file) )
+		switch( read_file(gameDataFilePtr) )
 		{
 		case 1:
 			rc = 1;
@@ -186,27 +348,124 @@ int GameFile::load_game(const char* filePath, SaveGameInfo* /*out*/ saveGameInfo
 			
 			//------- create the town network --------//
 			town_network_array.recreate_after_load();
+
+			//------- create the report views --------//
+			nation_view_array.recreate_after_load();
 		}
 	}
 
-	const auto position = file.file_pos();
+	return rc;
+}
+//--------- End of function GameFile::read_game --------//
+
+
+//-------- Begin of function GameFile::check_round_trip --------//
+//
+// Load the game data of a saved game, write it again to a memory file
+// and compare the bytes, for checking that saving keeps the format of
+// the records. The header and the Ambition data are not compared.
+// Started with the -savecheck command line option.
+//
+// return : <int> 1 - the same bytes are written
+//                0 - the bytes differ
+//               -1 - the game cannot be loaded
+//
+int GameFile::check_round_trip(const char* filePath)
+{
+	File file;
+	SaveGameHeader saveGameHeader;
+
+	if( !file.file_open(filePath, 0, 1) ||
+		 !file.file_read(&saveGameHeader, CLASS_SIZE) ||
+		 !validate_header(&saveGameHeader) )
+	{
+		printf("%s: cannot be loaded\n", filePath);
+		return -1;
+	}
+
+	//------ get the game data into memory, expanded if compressed ------//
+
+	File gameDataFile;
+	int rc;
+
+	if( saveGameHeader.class_size & COMPRESSED_FLAG )
+	{
+		rc = read_compressed(&file, &gameDataFile);
+	}
+	else
+	{
+		long dataSize = file.file_size() - file.file_pos();
+		char* dataBuf = mem_add( MAX(dataSize, 1L) );
+
+		rc = file.file_read(dataBuf, dataSize) &&
+			  gameDataFile.file_open_mem(dataBuf, dataSize, 0, 1);
+
+		if( !rc )
+			mem_del(dataBuf);
+	}
 
 	file.file_close();
 
-	Ambition::Serialisation::loadGame(filePath, position);
+	//------- load it and write it again -------//
 
-	//---------------------------------------//
+	if( rc )
+	{
+		config.terrain_set = saveGameHeader.info.terrain_set;
 
-	if (rc > 0)
+		game.deinit(1);
+		game.init(1);
+
+		rc = read_file(&gameDataFile) == 1;
+	}
+
+	if( !rc )
 	{
-		*saveGameInfo = saveGameHeader.info;
-		strncpy(scenario_file_name, saveGameInfo->file_name, FilePath::MAX_FILE_PATH);
-		scenario_file_name[FilePath::MAX_FILE_PATH] = 0;
+		printf("%s: cannot be loaded\n", filePath);
+		return -1;
 	}
 
-	return rc;
+	if( !read_file_same_version )		// converted when loaded, it cannot be written the same
+	{
+		printf("%s: saved by an older version, not compared\n", filePath);
+		return -1;
+	}
+
+	long readSize = gameDataFile.file_pos();		// old saves are followed by the Ambition data
+	File writtenFile;
+
+	rc = writtenFile.file_create_mem(0, 1) && write_file(&writtenFile);
+
+	if( !rc )
+	{
+		printf("%s: cannot be written\n", filePath);
+		return -1;
+	}
+
+	//------- compare the bytes -------//
+
+	long writtenSize = writtenFile.file_size();
+	char* readBuf = gameDataFile.file_mem_buf();
+	char* writtenBuf = writtenFile.file_mem_buf();
+	long diffOffset;
+
+	for( diffOffset=0 ; diffOffset<MIN(readSize, writtenSize) ; diffOffset++ )
+	{
+		if( readBuf[diffOffset] != writtenBuf[diffOffset] )
+			break;
+	}
+
+	if( diffOffset == readSize && readSize == writtenSize )
+	{
+		printf("%s: %ld bytes of game data written the same\n", filePath, readSize);
+		return 1;
+	}
+
+	printf("%s: %ld bytes read, %ld bytes written, first difference at byte %ld\n",
+		filePath, readSize, writtenSize, diffOffset);
+
+	return 0;
 }
-//--------- End of function GameFile::load_game --------//
+//--------- End of function GameFile::check_round_trip --------//
 
 
 //-------- Begin of function GameFile::read_header --------//
@@ -305,7 +564,7 @@ void GameFile::load_process()
 int GameFile::write_game_header(const SaveGameInfo& saveGameInfo, File* filePtr)
 {
 	SaveGameHeader saveGameHeader;
-	saveGameHeader.class_size = CLASS_SIZE;
+	saveGameHeader.class_size = CLASS_SIZE | COMPRESSED_FLAG;
 	saveGameHeader.info = saveGameInfo;
 	return filePtr->file_write( &saveGameHeader, sizeof(SaveGameHeader) );     // write the whole object to the saved game file
 }
@@ -315,11 +574,118 @@ int GameFile::write_game_header(const SaveGameInfo& saveGameInfo, File* filePtr)
 //--------- Begin of function GameFile::validate_header -------//
 bool GameFile::validate_header(const SaveGameHeader* saveGameHeader)
 {
-	return saveGameHeader->class_size == CLASS_SIZE && saveGameHeader->info.terrain_set > 0;
+	return (saveGameHeader->class_size & ~COMPRESSED_FLAG) == CLASS_SIZE && saveGameHeader->info.terrain_set > 0;
 }
 //--------- End of function GameFile::validate_header -------//
 
 
+//------- Begin of function GameFile::write_compressed -------//
+//
+// Compress the game data written to a memory file and write it to the
+// saved game file.
+//
+// <File*> gameDataFile - memory file with the game data
+// <File*> filePtr      - the saved game file
+//
+// Return : <int> 1 - file written successfully
+//                0 - not successful
+//
+int GameFile::write_compressed(File* gameDataFile, File* filePtr)
+{
+	long dataSize = gameDataFile->file_size();
+
+	//--- Lzw writes up to 15 bits for each byte and a few codes more ---//
+
+	unsigned char* packedBuf = (unsigned char*) mem_add_clear( dataSize*2 + LZW_BUF_MARGIN );
+
+	Lzw lzw;
+	long packedBits = lzw.compress( (unsigned char*) gameDataFile->file_mem_buf(), dataSize, packedBuf );
+
+	MSG("Game data of %ld bytes compressed to %ld\n", dataSize, (packedBits+7)/8);
+
+	//--- no record size before the compressed data, it can exceed 64K ---//
+
+	File::FileType fileType = filePtr->file_type;
+	filePtr->file_type = File::FLAT;
+
+	int rc = filePtr->file_put_long(dataSize) &&
+				filePtr->file_put_long(packedBits) &&
+				filePtr->file_write(packedBuf, (packedBits+7)/8);
+
+	filePtr->file_type = fileType;
+
+	mem_del(packedBuf);
+
+	return rc;
+}
+//--------- End of function GameFile::write_compressed -------//
+
+
+//------- Begin of function GameFile::read_compressed -------//
+//
+// Read the compressed game data from the saved game file and open the
+// expanded data as a memory file.
+//
+// <File*> filePtr      - the saved game file, after the header
+// <File*> gameDataFile - memory file to open with the game data
+//
+// Return : <int> 1 - read successfully
+//                0 - not successful
+//
+int GameFile::read_compressed(File* filePtr, File* gameDataFile)
+{
+	File::FileType fileType = filePtr->file_type;
+	filePtr->file_type = File::FLAT;
+
+	long dataSize = filePtr->file_get_long();
+	long packedBits = filePtr->file_get_long();
+
+	//--- the compressed data must be in the rest of the file, a code is at least 9 bits ---//
+
+	long restSize = filePtr->file_size() - filePtr->file_pos();
+
+	int rc = dataSize > 0 && packedBits >= 9 && restSize > 0 &&
+				packedBits <= restSize * 8;
+
+	long packedSize = rc ? (packedBits+7)/8 : 0;
+	unsigned char* packedBuf = NULL;
+
+	if( rc )
+	{
+		packedBuf = (unsigned char*) mem_add_clear( packedSize + LZW_BUF_MARGIN );
+		rc = filePtr->file_read(packedBuf, packedSize);
+	}
+
+	filePtr->file_type = fileType;
+
+	//--- expand the game data without output first, so the buffer is only allocated ---//
+	//--- if the data is not corrupted and has the size in the file ---//
+
+	Lzw lzw;
+
+	if( rc )
+		rc = lzw.expand( packedBuf, packedBits, NULL ) == dataSize;
+
+	if( rc )
+	{
+		char* dataBuf = mem_add( dataSize + LZW_BUF_MARGIN );
+
+		rc = lzw.expand( packedBuf, packedBits, (unsigned char*) dataBuf ) == dataSize;
+
+		if( rc )
+			rc = gameDataFile->file_open_mem(dataBuf, dataSize, 0, 1);
+		else
+			mem_del(dataBuf);
+	}
+
+	if( packedBuf )
+		mem_del(packedBuf);
+
+	return rc;
+}
+//--------- End of function GameFile::read_compressed -------//
+
+
 //--------- Begin of function GameFile::status_str -------//
 const char *GameFile::status_str()
 {
@@ -1261,6 +1261,7 @@ int Config::read_file(File* filePtr, int keepSysSettings)
 		return 0;
 
 	r.check_record_size(CONFIG_RECORD_SIZE);
+	r.prefetch(CONFIG_RECORD_SIZE);
 	v.init(&r);
 	visit_config(&v, this);
 
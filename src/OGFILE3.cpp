@@ -371,6 +371,7 @@ int Unit::read_file(File* filePtr)
 		return 0;
 
 	r.check_record_size(169);
+	r.prefetch(169);
 	v.init(&r);
 	visit_unit(&v, this);
 
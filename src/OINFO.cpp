@@ -39,6 +39,7 @@
 #include <OSYS.h>
 #include <OUNIT.h>
 #include <OINFO.h>
+#include <OINFOFLD.h>
 #include <OOPTMENU.h>
 #include "gettext.h"
 
@@ -292,6 +293,8 @@ void Info::disp()
 	vga_back.put_bitmap( INFO_X1, INFO_Y1, info_background_bitmap );
 	vga_front.put_bitmap( INFO_X1, INFO_Y1, info_background_bitmap );
 
+	info_field_cache.clear();
+
 	//------- use front buffer -------//
 
 	int saveUseBackBuf = vga.use_back_buf;
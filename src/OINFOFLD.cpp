@@ -0,0 +1,148 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : OINFOFLD.CPP
+//Description : Object InfoFieldCache
+
+#include <string.h>
+#include <ALL.h>
+#include <OVGA.h>
+#include <OFONT.h>
+#include <OINFOFLD.h>
+
+//------- Begin of function InfoFieldCache::clear -------//
+
+void InfoFieldCache::clear()
+{
+	for( int i=0 ; i<MAX_INFO_FIELD ; i++ )
+		field_array[i].font_ptr = NULL;
+}
+//-------- End of function InfoFieldCache::clear --------//
+
+
+//------- Begin of function InfoFieldCache::clear_area -------//
+//
+// Forget the fields in the given area of the front buffer, as it
+// has been painted over.
+//
+void InfoFieldCache::clear_area(int x1, int y1, int x2, int y2)
+{
+	InfoField* fieldPtr = field_array;
+
+	for( int i=0 ; i<MAX_INFO_FIELD ; i++, fieldPtr++ )
+	{
+		if( !fieldPtr->font_ptr )
+			continue;
+
+		if( x1 <= fieldPtr->last_x && x2 >= fieldPtr->x &&
+			 y1 <= fieldPtr->y + fieldPtr->font_ptr->height() + 3 && y2 >= fieldPtr->y )
+		{
+			fieldPtr->font_ptr = NULL;
+		}
+	}
+}
+//-------- End of function InfoFieldCache::clear_area --------//
+
+
+//------- Begin of function InfoFieldCache::get_field -------//
+//
+// <Font*> fontPtr  = the font of the field
+// <int>   x, y     = the position of the value
+// <char*> textPtr  = the value to be shown
+// <int&>  lastX    = for returning the x coordination of the last pixel
+//                    of the value on the screen
+//
+// return : <int> 1 - the value on the screen is the same, it does not
+//                    need to be drawn again
+//                0 - it must be drawn
+//
+int InfoFieldCache::get_field(Font* fontPtr, int x, int y, const char* textPtr, int& lastX)
+{
+	if( Vga::use_back_buf )
+		return 0;
+
+	InfoField* fieldPtr = find_field(fontPtr, x, y);
+
+	if( !fieldPtr || strcmp(fieldPtr->text, textPtr) )
+		return 0;
+
+	lastX = fieldPtr->last_x;
+	return 1;
+}
+//-------- End of function InfoFieldCache::get_field --------//
+
+
+//------- Begin of function InfoFieldCache::set_field -------//
+//
+// Called after the value of a field is drawn.
+//
+void InfoFieldCache::set_field(Font* fontPtr, int x, int y, const char* textPtr, int lastX)
+{
+	if( Vga::use_back_buf )
+		return;
+
+	InfoField* fieldPtr = find_field(fontPtr, x, y);
+
+	if( !fieldPtr )
+	{
+		for( int i=0 ; i<MAX_INFO_FIELD ; i++ )
+		{
+			if( !field_array[i].font_ptr )
+			{
+				fieldPtr = field_array+i;
+				break;
+			}
+		}
+
+		if( !fieldPtr )		// all used, the field is drawn every time
+			return;
+	}
+
+	if( strlen(textPtr) > MAX_INFO_FIELD_TEXT )		// too long to be compared
+	{
+		fieldPtr->font_ptr = NULL;
+		return;
+	}
+
+	fieldPtr->font_ptr = fontPtr;
+	fieldPtr->x = x;
+	fieldPtr->y = y;
+	fieldPtr->last_x = MAX(lastX, x);
+	strcpy( fieldPtr->text, textPtr );
+}
+//-------- End of function InfoFieldCache::set_field --------//
+
+
+//------- Begin of function InfoFieldCache::find_field -------//
+
+InfoField* InfoFieldCache::find_field(Font* fontPtr, int x, int y)
+{
+	InfoField* fieldPtr = field_array;
+
+	for( int i=0 ; i<MAX_INFO_FIELD ; i++, fieldPtr++ )
+	{
+		if( fieldPtr->font_ptr==fontPtr && fieldPtr->x==x && fieldPtr->y==y )
+			return fieldPtr;
+	}
+
+	return NULL;
+}
+//-------- End of function InfoFieldCache::find_field --------//
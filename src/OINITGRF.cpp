@@ -0,0 +1,213 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : OINITGRF.CPP
+//Description : Object InitGraph
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <stdio.h>
+#include <ALL.h>
+#include <OFILEPRE.h>
+#include <OINITGRF.h>
+
+//------- Begin of function InitGraph::InitGraph -------//
+
+InitGraph::InitGraph(const char* graphName)
+{
+	graph_name = graphName;
+}
+//-------- End of function InitGraph::InitGraph --------//
+
+
+//------- Begin of function InitGraph::add_step -------//
+//
+// <char*>    stepName    = name of the step for the log
+// <function> initFunc    = the init to be run
+// [vector]   dependArray = ids. of the steps that must be done first,
+//                          as returned by add_step()
+// [vector]   fileArray   = files the init reads in whole
+// [int]      threadFlag  = whether the init can be run on a worker thread,
+//                          it must not use game_set, misc, sys.common_data_buf
+//                          or the objects of other steps not in dependArray
+//                          (default: 0)
+//
+// return : <int> the id. of the step
+//
+int InitGraph::add_step(const char* stepName, std::function<void()> initFunc,
+								std::vector<int> dependArray, std::vector<std::string> fileArray,
+								int threadFlag)
+{
+	InitStep initStep;
+
+	initStep.name          = stepName;
+	initStep.init_func     = initFunc;
+	initStep.depend_array  = dependArray;
+	initStep.file_array    = fileArray;
+#ifdef NO_MEM_CLASS
+	initStep.thread_flag   = (char) threadFlag;
+#else
+	initStep.thread_flag   = 0;			// the Mem class is not thread safe, MemStat is
+#endif
+	initStep.run_ms        = 0;
+	initStep.finish_ms     = 0;
+	initStep.critical_step = -1;
+
+	for( size_t i=0 ; i<dependArray.size() ; i++ )
+		err_when( dependArray[i] < 0 || dependArray[i] >= (int) step_array.size() );		// steps can only need the steps added before them
+
+	step_array.push_back(initStep);
+
+	return (int) step_array.size() - 1;
+}
+//-------- End of function InitGraph::add_step --------//
+
+
+//------- Begin of function InitGraph::run -------//
+
+void InitGraph::run()
+{
+	//------ read the files ahead in the order of the steps ------//
+
+	std::vector<std::string> fileNameArray;
+	size_t i, j;
+
+	for( i=0 ; i<step_array.size() ; i++ )
+		fileNameArray.insert( fileNameArray.end(), step_array[i].file_array.begin(), step_array[i].file_array.end() );
+
+	file_preload.start(fileNameArray);
+
+	//----------- run the steps ------------//
+
+	typedef std::chrono::steady_clock Clock;
+
+	Clock::time_point graphStartTime = Clock::now();
+
+	std::mutex						stepMutex;
+	std::condition_variable		stepCond;
+	std::vector<char>				doneArray( step_array.size(), 0 );
+	std::vector<std::thread>	threadArray;
+
+	auto runStep = [&](int stepId)
+	{
+		InitStep* stepPtr = &step_array[stepId];
+
+		//---- wait for the steps it needs, they are added before it ----//
+
+		{
+			std::unique_lock<std::mutex> lock(stepMutex);
+
+			stepCond.wait( lock, [&]()
+			{
+				for( size_t k=0 ; k<stepPtr->depend_array.size() ; k++ )
+				{
+					if( !doneArray[ stepPtr->depend_array[k] ] )
+						return false;
+				}
+				return true;
+			} );
+		}
+
+		Clock::time_point startTime = Clock::now();
+
+		stepPtr->init_func();
+
+		stepPtr->run_ms = std::chrono::duration<double, std::milli>(Clock::now() - startTime).count();
+
+		{
+			std::lock_guard<std::mutex> lock(stepMutex);
+			doneArray[stepId] = 1;
+		}
+
+		stepCond.notify_all();
+	};
+
+	//--- start the worker steps first, so they do not wait for the steps added before them ---//
+
+	for( i=0 ; i<step_array.size() ; i++ )
+	{
+		if( step_array[i].thread_flag )
+			threadArray.emplace_back( runStep, (int) i );
+	}
+
+	for( i=0 ; i<step_array.size() ; i++ )
+	{
+		if( !step_array[i].thread_flag )
+			runStep( (int) i );
+	}
+
+	for( i=0 ; i<threadArray.size() ; i++ )
+		threadArray[i].join();
+
+	double totalMs = std::chrono::duration<double, std::milli>(Clock::now() - graphStartTime).count();
+
+	file_preload.finish();
+
+	//--- when each step could finish, if it started once the steps it needs are done ---//
+
+	int lastStep = 0;
+
+	for( i=0 ; i<step_array.size() ; i++ )
+	{
+		InitStep* stepPtr = &step_array[i];
+		double startMs = 0;
+
+		stepPtr->critical_step = -1;
+
+		for( j=0 ; j<stepPtr->depend_array.size() ; j++ )
+		{
+			InitStep* dependStep = &step_array[ stepPtr->depend_array[j] ];
+
+			if( dependStep->finish_ms > startMs )
+			{
+				startMs = dependStep->finish_ms;
+				stepPtr->critical_step = stepPtr->depend_array[j];
+			}
+		}
+
+		stepPtr->finish_ms = startMs + stepPtr->run_ms;
+
+		if( stepPtr->finish_ms > step_array[lastStep].finish_ms )
+			lastStep = (int) i;
+	}
+
+	//----------- print the times ------------//
+
+	if( step_array.empty() )
+		return;
+
+	for( i=0 ; i<step_array.size() ; i++ )
+	{
+		printf("%s: %-16s %7.1f ms%s\n", graph_name, step_array[i].name, step_array[i].run_ms,
+			step_array[i].thread_flag ? " (worker thread)" : "");
+	}
+
+	std::string criticalPath;
+
+	for( int stepId=lastStep ; stepId>=0 ; stepId=step_array[stepId].critical_step )
+		criticalPath = std::string(step_array[stepId].name) + (criticalPath.empty() ? "" : " > ") + criticalPath;
+
+	printf("%s: %.1f ms in total, %.1f ms on the longest chain: %s\n", graph_name,
+		totalMs, step_array[lastStep].finish_ms, criticalPath.c_str());
+}
+//-------- End of function InitGraph::run --------//
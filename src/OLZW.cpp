@@ -57,7 +57,7 @@ struct Dictionary
 };
 
 
-BitStream::BitStream() : bit_offset(0)
+BitStream::BitStream() : bit_offset(0), overrun_flag(0)
 {
 }
 
@@ -76,12 +76,18 @@ void BitStream::output_bits(unsigned short stringCode, unsigned stringLen)
 	bit_offset += stringLen;
 }
 
-BitMemStream::BitMemStream(unsigned char *p) : BitStream(), bytePtr(p)
+BitMemStream::BitMemStream(unsigned char *p, long bitLen) : BitStream(), bytePtr(p), bit_len(bitLen)
 {
 }
 
 unsigned short BitMemStream::input_bits(unsigned stringLen)
 {
+	if( bit_len >= 0 && bit_offset + (long) stringLen > bit_len )
+	{
+		overrun_flag = 1;
+		return 0;
+	}
+
 	unsigned char *p = bytePtr + bit_offset / 8;
 	int s = bit_offset % 8;
 	
@@ -259,9 +265,10 @@ long Lzw::compress( unsigned char *inPtr, long inByteLen, unsigned char *outPtr)
 }
 
 // set outPtr to NULL to find the decompressed size
+// return -1 if the data is corrupted or longer than inBitLen
 long Lzw::expand( unsigned char *inPtr, long inBitLen, unsigned char *outPtr)
 {
-	BitMemStream memStream(inPtr);
+	BitMemStream memStream(inPtr, inBitLen);
 	return basic_expand( &memStream, outPtr );
 }
 
@@ -349,7 +356,8 @@ long Lzw::basic_compress( unsigned char *inPtr, long inByteLen, BitStream *outSt
 // <unsigned char *> outPtr          address of decompressed output data
 //                                   (NULL to find the size of decompressed data)
 //
-// return the no. of byte of the decompressed data
+// return the no. of byte of the decompressed data, -1 if the data is
+// corrupted. outPtr must have room for the size found with NULL.
 // call free_storage after decompress to free allocated space, if it will
 // not going to compress/decompress soon
 long Lzw::basic_expand( BitStream *inStream, unsigned char *outPtr)
@@ -357,7 +365,7 @@ long Lzw::basic_expand( BitStream *inStream, unsigned char *outPtr)
 	unsigned short newCode;
 	unsigned short oldCode;
 	unsigned char character;
-	unsigned int count;
+	int count;
 
 	long outByteLen = 0;
 
@@ -367,11 +375,15 @@ long Lzw::basic_expand( BitStream *inStream, unsigned char *outPtr)
 		initialize_dictionary();
 		oldCode = inStream->input_bits( current_code_bits );
 
+		if ( inStream->overrun_flag )
+			return -1;
 		if ( oldCode == END_OF_STREAM )
 		{
 			// free_storage();
 			return outByteLen;
 		}
+		if ( oldCode > 255 )			// a dictionary always starts with a character
+			return -1;
 		character = (unsigned char) oldCode;
 		if( outPtr )
 			outPtr[outByteLen] = character;
@@ -380,6 +392,8 @@ long Lzw::basic_expand( BitStream *inStream, unsigned char *outPtr)
 		for ( ; ; )
 		{
 			newCode = inStream->input_bits( current_code_bits );
+			if ( inStream->overrun_flag )
+				return -1;
 			if ( newCode == END_OF_STREAM )
 			{
 				// free_storage();
@@ -389,16 +403,22 @@ long Lzw::basic_expand( BitStream *inStream, unsigned char *outPtr)
 				break;
 			if ( newCode == BUMP_CODE )
 			{
+				if ( current_code_bits >= BITS )
+					return -1;
 				current_code_bits++;
 				continue;
 			}
-			if ( newCode >= next_code )
+			if ( newCode > next_code || next_code > MAX_CODE )	// the dictionary would have been flushed
+				return -1;
+			if ( newCode == next_code )
 			{
 				decode_stack[ 0 ] = character;
 				count = decode_string( 1, oldCode );
 			}
 			else
 				count = decode_string( 0, newCode );
+			if ( count < 0 )
+				return -1;
 			character = decode_stack[ count - 1 ];
 			if( outPtr )
 			{
@@ -410,7 +430,6 @@ long Lzw::basic_expand( BitStream *inStream, unsigned char *outPtr)
 				outByteLen += count;
 			}
 
-			err_when( next_code >= TABLE_SIZE);
 			DICT( next_code ).parent_code = oldCode;
 			DICT( next_code ).character = character;
 			next_code++;
@@ -461,15 +480,15 @@ unsigned short Lzw::find_child_node( unsigned short parentCode, unsigned char ch
 //
 // This routine decodes a string from the dictionary, and stores it
 // in the decode_stack data structure.  It returns a count to the
-// calling program of how many characters were placed in the stack.
+// calling program of how many characters were placed in the stack,
+// -1 if the string is longer than the stack, as in a corrupted stream.
 //
-unsigned int Lzw::decode_string( unsigned int count, unsigned short code )
+int Lzw::decode_string( unsigned int count, unsigned short code )
 {
-	unsigned short initCode = code;
-
 	while ( code > 255 )
 	{
-		err_when(count >= TABLE_SIZE);
+		if( count >= TABLE_SIZE-1 )
+			return -1;
 		decode_stack[ count++ ] = DICT( code ).character;
 		code = DICT( code ).parent_code;
 	}
@@ -27,6 +27,7 @@
 #include <OTERRAIN.h>
 #include <OUNIT.h>
 #include <OHILLRES.h>
+#include <OWORLD.h>
 
 // --------- define constant ----------//
 #define DEFAULT_WALL_TIMEOUT 10
@@ -186,7 +187,7 @@ void Matrix::paint()
 //
 void Matrix::draw()
 {
-	int       i=0, x, y, xLoc, yLoc;
+	int       x, y, xLoc, yLoc;
 	Location* locPtr;
 
 	int maxXLoc = top_x_loc + disp_x_loc;        // divide by 2 for world_info
@@ -196,9 +197,6 @@ void Matrix::draw()
 
 	for( y=image_y1,yLoc=top_y_loc ; yLoc<maxYLoc ; yLoc++, y+=loc_height )
 	{
-		if( (i++)%10==0 )
-			sys.yield();
-
 		locPtr = get_loc(top_x_loc,yLoc);
 
 		for( x=image_x1,xLoc=top_x_loc ; xLoc<maxXLoc ; xLoc++, x+=loc_width, locPtr++ )
@@ -417,10 +415,42 @@ void Location::walkable_reset()
 			loc_flag |= LOCATE_WALK_LAND;
 		}
 	}
+
+	world.update_pass_maps(this);
 }
 // ----------- End of function Location::walkable_reset -------//
 
 
+// ------- Begin of function Location::walkable_off -----/
+void Location::walkable_off()
+{
+	loc_flag &= ~(LOCATE_WALK_LAND | LOCATE_WALK_SEA);
+
+	world.update_pass_maps(this);
+}
+// ----------- End of function Location::walkable_off -------//
+
+
+// ------- Begin of function Location::walkable_on -----/
+void Location::walkable_on(int teraMask)
+{
+	loc_flag |= teraMask;
+
+	world.update_pass_maps(this);
+}
+// ----------- End of function Location::walkable_on -------//
+
+
+// ------- Begin of function Location::walkable_off -----/
+void Location::walkable_off(int teraMask)
+{
+	loc_flag &= ~teraMask;
+
+	world.update_pass_maps(this);
+}
+// ----------- End of function Location::walkable_off -------//
+
+
 // ----------- Begin of function Location::is_plateau ---------//
 int Location::is_plateau()
 {
@@ -439,6 +469,8 @@ void Location::set_site(int siteRecno)
 	// loc_flag |= LOCATION_HAS_SITE;
 
 	extra_para = siteRecno;
+
+	world.update_pass_maps(this);
 }
 //------------ End of function Location::set_site ------------//
 
@@ -452,6 +484,8 @@ void Location::remove_site()
 	loc_flag &= ~LOCATE_SITE_MASK;
 
 	extra_para  = 0;
+
+	world.update_pass_maps(this);
 }
 //------------ End of function Location::remove_site ------------//
 
@@ -528,6 +562,8 @@ void Location::set_firm(int firmRecno)
 	loc_flag = (loc_flag & ~LOCATE_BLOCK_MASK) | LOCATE_IS_FIRM;
 
 	cargo_recno = firmRecno;
+
+	world.update_pass_maps(this);
 }
 //------------ End of function Location::set_firm ------------//
 
@@ -557,6 +593,8 @@ void Location::set_town(int townRecno)
 	loc_flag = loc_flag & ~LOCATE_BLOCK_MASK | LOCATE_IS_TOWN;
 
 	cargo_recno = townRecno;
+
+	world.update_pass_maps(this);
 }
 //------------ End of function Location::set_town ------------//
 
@@ -612,6 +650,8 @@ void Location::set_hill(int hillId)
 		cargo_recno = hillId;
 		extra_para = 0;
 	}
+
+	world.update_pass_maps(this);
 }
 //------------ End of function Location::set_hill ------------//
 
@@ -627,6 +667,8 @@ void Location::remove_hill()
 	cargo_recno = 0;
 	// err_when(is_firm());
 	// BUGHERE : need to call walkable_reset();
+
+	world.update_pass_maps(this);
 }
 //------------ End of function Location::remove_hill ------------//
 
@@ -647,6 +689,8 @@ void Location::set_wall(int wallId, int townRecno, int hitPoints)
 
 	extra_para  = wallId;
 	cargo_recno = (hitPoints<<8) + townRecno;
+
+	world.update_pass_maps(this);
 }
 //------------ End of function Location::set_wall ------------//
 
@@ -782,6 +826,8 @@ void Location::set_plant(int plantId, int offsetX, int offsetY)
 	extra_para  = plantId;
 	cargo_recno = (offsetY<<8) + offsetX;
 	err_when(cargo_recno==0 || is_firm());
+
+	world.update_pass_maps(this);
 }
 //------------ End of function Location::set_plant ------------//
 
@@ -811,6 +857,8 @@ void Location::set_rock(short rockArrayRecno)
 	loc_flag = loc_flag & ~LOCATE_BLOCK_MASK | LOCATE_IS_ROCK;
 
 	cargo_recno = rockArrayRecno;
+
+	world.update_pass_maps(this);
 }
 //------------ End of function Location::set_rock ------------//
 
@@ -944,6 +992,8 @@ int Location::is_unit_group_accessible(int mobileType, uint32_t curGroupId)
 void Location::set_power_on()
 {
 	loc_flag &= ~LOCATE_POWER_OFF;
+
+	world.update_pass_maps(this);
 }
 //-------- End of function Location::set_power_on --------//
 
@@ -952,6 +1002,8 @@ void Location::set_power_on()
 void Location::set_power_off()
 {
 	loc_flag |= LOCATE_POWER_OFF;
+
+	world.update_pass_maps(this);
 }
 //-------- End of function Location::set_power_off --------//
 
@@ -27,6 +27,7 @@
 #ifndef NO_MEM_CLASS
 
 #include <stdio.h>
+#include <mutex>
 #include <ALL.h>
 #include <dbglog.h>
 
@@ -55,6 +56,8 @@ DBGLOG_DEFAULT_CHANNEL(Mem);
 
 #define SPOOL_MEM  50         // 50 bytes spool memory for mem_add(),
 
+static std::recursive_mutex mem_mutex;		// the file reading threads of SpriteLoader and FilePreload allocate too
+
 struct MemInfo
 {
    void     *ptr;       // this pointer directly point to useable buffer
@@ -88,6 +91,8 @@ Mem::Mem()
 //
 char* Mem::add(unsigned memSize, const char* fileName, int fileLine)
 {
+	std::lock_guard<std::recursive_mutex> lock(mem_mutex);
+
 	// ###### begin Gilbert 29/8 ######//
 	//err_when( memSize > 1000000 );		//**BUGHERE, for temporary debugging only
 	err_when( memSize > 0x800000 );
@@ -154,6 +159,8 @@ char* Mem::add(unsigned memSize, const char* fileName, int fileLine)
 //
 char* Mem::add_clear(unsigned memSize, const char* fileName, int fileLine)
 {
+	std::lock_guard<std::recursive_mutex> lock(mem_mutex);
+
 	err_when( memSize > 1000000 );		//**BUGHERE, for temporary debugging only
 
 	//----------- build up memory pointer table ---------//
@@ -226,6 +233,8 @@ char* Mem::add_clear(unsigned memSize, const char* fileName, int fileLine)
 //
 char* Mem::resize_keep_data(void *orgPtr, unsigned orgSize, unsigned newSize, const char* fileName, int fileLine)
 {
+	std::lock_guard<std::recursive_mutex> lock(mem_mutex);
+
    if( orgPtr == NULL )
       return add( newSize, fileName, fileLine);
 
@@ -275,6 +284,8 @@ char* Mem::resize_keep_data(void *orgPtr, unsigned orgSize, unsigned newSize, co
 //
 char* Mem::resize(void *orgPtr, unsigned memSize, const char* fileName, int fileLine)
 {
+	std::lock_guard<std::recursive_mutex> lock(mem_mutex);
+
 	err_when( memSize > 1000000 );		//**BUGHERE, for temporary debugging only
 
    if( orgPtr == NULL )
@@ -328,6 +339,8 @@ char* Mem::resize(void *orgPtr, unsigned memSize, const char* fileName, int file
 //
 void Mem::del(void *freePtr, const char* fileName, int fileLine)
 {
+	std::lock_guard<std::recursive_mutex> lock(mem_mutex);
+
    int   i ;
    char* truePtr;
 
@@ -375,6 +388,8 @@ void Mem::del(void *freePtr, const char* fileName, int fileLine)
 //
 int Mem::get_mem_size(void *memPtr)
 {
+	std::lock_guard<std::recursive_mutex> lock(mem_mutex);
+
 	for( int i=ptr_used-1; i>=0; i-- )
 	{
 		if( info_array[i].ptr == memPtr )
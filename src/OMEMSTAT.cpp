@@ -0,0 +1,536 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OMEMSTAT.CPP
+//Description : Object MemStat
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cstddef>
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+
+#include "ambition/7kaaInterface/control.hh"
+
+#include <ALL.h>
+#include <OMEMSTAT.h>
+#include <OFONT.h>
+#include <OWORLDMT.h>
+#include <OSYS.h>
+#include <FilePath.h>
+
+
+//--------- Define constant ---------//
+
+enum { MEM_BLOCK_CHECK_VAL = 0x4D53,
+		 DUMP_INTERVAL = 10*60*1000,				// dump to MEMSTAT.LOG every 10 minutes
+		 DUMP_ACCOUNT_COUNT = 16 };					// the accounts with the most memory in a dump
+
+static const char* subsystem_name_array[MEM_SUBSYSTEM_COUNT] =
+{
+	"Other", "DynArray", "SeekPath", "Resource", "VLenQueue",
+};
+
+//------ Define struct MemBlockHeader ------//
+//
+// Before each block allocated by MemStat, aligned like malloc() so the
+// block after it is too.
+//
+struct alignas(std::max_align_t) MemBlockHeader
+{
+	uint32_t size;
+	uint16_t account_id;
+	uint16_t check_val;
+};
+
+//------ Define struct MemAccount ------//
+
+struct MemAccount
+{
+	const char*					file_name;				// NULL for account 0, all files after MAX_MEM_ACCOUNT
+	char							subsystem;
+
+	std::atomic<long long>	live_size;
+	std::atomic<long>			live_count;
+	std::atomic<long>			frame_add_count;		// allocations since the last next_frame()
+
+	long							last_frame_add_count;
+	long long					leak_check_size;		// live_size when start_leak_check() was called
+};
+
+//------ Define static variables ------//
+
+static MemAccount					account_array[MAX_MEM_ACCOUNT];
+static std::atomic<int>			account_count;
+static std::mutex					account_mutex;
+
+static std::atomic<long long>	total_live_size;
+static std::atomic<long long>	total_peak_size;
+
+static long long					subsystem_live_size[MEM_SUBSYSTEM_COUNT];
+static long long					subsystem_peak_size[MEM_SUBSYSTEM_COUNT];	// sampled once a frame
+static long							subsystem_frame_add_count[MEM_SUBSYSTEM_COUNT];
+static long							last_frame_add_count;
+
+static char							leak_check_flag;
+static unsigned long				next_dump_time;
+static char							log_started_flag;				// MEMSTAT.LOG has been emptied in this run
+
+static const char* MEM_LOG_FILE_NAME = "MEMSTAT.LOG";
+
+//------ Declare static functions ------//
+
+static char	file_subsystem(const char* fileName);
+static void	account_add(int accountId, unsigned memSize);
+static void	account_del(int accountId, unsigned memSize);
+static FILE*	open_log();
+static void	close_log(FILE* filePtr);
+
+
+//--------- Begin of function MemStat::add_account ---------//
+//
+// Called once for each call site, through MEM_ACCOUNT_ID().
+//
+// return : <int> the account of the source file
+//
+int MemStat::add_account(const char* fileName)
+{
+	std::lock_guard<std::mutex> lock(account_mutex);
+
+	int accountCount = account_count;
+
+	if( accountCount == 0 )
+		accountCount = 1;			// account 0 is for the files after MAX_MEM_ACCOUNT
+
+	for( int i=1 ; i<accountCount ; i++ )
+	{
+		if( strcmp(account_array[i].file_name, fileName) == 0 )
+			return i;
+	}
+
+	if( accountCount >= MAX_MEM_ACCOUNT )
+		return 0;
+
+	MemAccount* accountPtr = account_array + accountCount;
+
+	accountPtr->file_name = fileName;
+	accountPtr->subsystem = file_subsystem(fileName);
+
+	account_count = accountCount+1;		// published after the account is filled in
+
+	return accountCount;
+}
+//----------- End of function MemStat::add_account -----------//
+
+
+//--------- Begin of function MemStat::add ---------//
+//
+// <unsigned> memSize   = the size of the memory to be allocated
+// <int>      accountId = MEM_ACCOUNT_ID() of the caller
+//
+char* MemStat::add(unsigned memSize, int accountId)
+{
+	MemBlockHeader* headerPtr = (MemBlockHeader*) malloc( sizeof(MemBlockHeader) + memSize );
+
+	if( !headerPtr )
+		return NULL;
+
+	headerPtr->size       = memSize;
+	headerPtr->account_id = accountId;
+	headerPtr->check_val  = MEM_BLOCK_CHECK_VAL;
+
+	account_add(accountId, memSize);
+
+	return (char*) (headerPtr+1);
+}
+//----------- End of function MemStat::add -----------//
+
+
+//--------- Begin of function MemStat::add_clear ---------//
+//
+char* MemStat::add_clear(unsigned memSize, int accountId)
+{
+	MemBlockHeader* headerPtr = (MemBlockHeader*) calloc( 1, sizeof(MemBlockHeader) + memSize );
+
+	if( !headerPtr )
+		return NULL;
+
+	headerPtr->size       = memSize;
+	headerPtr->account_id = accountId;
+	headerPtr->check_val  = MEM_BLOCK_CHECK_VAL;
+
+	account_add(accountId, memSize);
+
+	return (char*) (headerPtr+1);
+}
+//----------- End of function MemStat::add_clear -----------//
+
+
+//--------- Begin of function MemStat::resize ---------//
+//
+// The block is moved to the account of the caller, so the growth of a
+// DynArray is counted where it is resized.
+//
+char* MemStat::resize(void* orgPtr, unsigned memSize, int accountId)
+{
+	if( !orgPtr )
+		return add(memSize, accountId);
+
+	MemBlockHeader* headerPtr = (MemBlockHeader*) orgPtr - 1;
+
+	err_when( headerPtr->check_val != MEM_BLOCK_CHECK_VAL );
+
+	unsigned orgSize = headerPtr->size;
+	int orgAccountId = headerPtr->account_id;
+
+	headerPtr = (MemBlockHeader*) realloc( headerPtr, sizeof(MemBlockHeader) + memSize );
+
+	if( !headerPtr )
+		return NULL;
+
+	headerPtr->size       = memSize;
+	headerPtr->account_id = accountId;
+
+	account_del(orgAccountId, orgSize);
+	account_add(accountId, memSize);
+
+	return (char*) (headerPtr+1);
+}
+//----------- End of function MemStat::resize -----------//
+
+
+//--------- Begin of function MemStat::del ---------//
+//
+void MemStat::del(void* memPtr)
+{
+	if( !memPtr )
+		return;
+
+	MemBlockHeader* headerPtr = (MemBlockHeader*) memPtr - 1;
+
+	err_when( headerPtr->check_val != MEM_BLOCK_CHECK_VAL );
+
+	account_del(headerPtr->account_id, headerPtr->size);
+
+	headerPtr->check_val = 0;		// catch freeing it twice
+	free(headerPtr);
+}
+//----------- End of function MemStat::del -----------//
+
+
+//--------- Begin of function MemStat::next_frame ---------//
+//
+// Called every frame, sums up the accounts by subsystem and dumps them
+// to the log every DUMP_INTERVAL.
+//
+void MemStat::next_frame()
+{
+	memset( subsystem_live_size, 0, sizeof(subsystem_live_size) );
+	memset( subsystem_frame_add_count, 0, sizeof(subsystem_frame_add_count) );
+	last_frame_add_count = 0;
+
+	int accountCount = account_count;
+
+	for( int i=0 ; i<accountCount ; i++ )
+	{
+		MemAccount* accountPtr = account_array + i;
+
+		accountPtr->last_frame_add_count = accountPtr->frame_add_count.exchange(0, std::memory_order_relaxed);
+
+		int subsystem = (unsigned char) accountPtr->subsystem;
+
+		subsystem_live_size[subsystem] += accountPtr->live_size.load(std::memory_order_relaxed);
+		subsystem_frame_add_count[subsystem] += accountPtr->last_frame_add_count;
+		last_frame_add_count += accountPtr->last_frame_add_count;
+	}
+
+	for( int i=0 ; i<MEM_SUBSYSTEM_COUNT ; i++ )
+	{
+		if( subsystem_live_size[i] > subsystem_peak_size[i] )
+			subsystem_peak_size[i] = subsystem_live_size[i];
+	}
+
+	//-------- periodic dump --------//
+
+	if( next_dump_time == 0 )
+		next_dump_time = misc.get_time() + DUMP_INTERVAL;
+
+	if( misc.get_time() >= next_dump_time )
+	{
+		dump("periodic");
+		next_dump_time = misc.get_time() + DUMP_INTERVAL;
+	}
+}
+//----------- End of function MemStat::next_frame -----------//
+
+
+//--------- Begin of function MemStat::start_leak_check ---------//
+//
+// Called when a game starts. end_leak_check() reports the files that
+// have more memory allocated when the game has ended than now.
+//
+void MemStat::start_leak_check()
+{
+	int accountCount = account_count;
+
+	for( int i=0 ; i<accountCount ; i++ )
+		account_array[i].leak_check_size = account_array[i].live_size.load(std::memory_order_relaxed);
+
+	leak_check_flag = 1;
+}
+//----------- End of function MemStat::start_leak_check -----------//
+
+
+//--------- Begin of function MemStat::end_leak_check ---------//
+//
+// Called when a game has ended and its data has been freed.
+//
+void MemStat::end_leak_check()
+{
+	if( !leak_check_flag )
+		return;
+
+	leak_check_flag = 0;
+
+	int accountCount = account_count;
+	FILE* logFile = NULL;			// only opened when memory is kept
+
+	for( int i=0 ; i<accountCount ; i++ )
+	{
+		MemAccount* accountPtr = account_array + i;
+		long long keptSize = accountPtr->live_size.load(std::memory_order_relaxed) - accountPtr->leak_check_size;
+
+		//--- files added during the game started with nothing allocated ---//
+
+		if( keptSize > 0 )
+		{
+			if( !logFile )
+			{
+				logFile = open_log();
+				fprintf(logFile, "Memory kept after the game:\n");
+			}
+
+			fprintf(logFile, "  %-24s %12lld bytes more allocated than before the game\n",
+				accountPtr->file_name ? accountPtr->file_name : "(other files)", keptSize);
+		}
+	}
+
+	if( logFile )
+		close_log(logFile);
+}
+//----------- End of function MemStat::end_leak_check -----------//
+
+
+//--------- Begin of function MemStat::dump ---------//
+//
+// Writes the memory by subsystem and the files with the most memory
+// allocated to MEMSTAT.LOG.
+//
+// <const char*> reason - what triggered the dump
+//
+void MemStat::dump(const char* reason)
+{
+	FILE* logFile = open_log();
+
+	fprintf(logFile, "Memory (%s): %lld bytes allocated, peak %lld, %ld allocations last frame, %llu Ambition entities\n",
+		reason, total_live_size.load(std::memory_order_relaxed), total_peak_size.load(std::memory_order_relaxed),
+		last_frame_add_count, Ambition::Control::entityCount());
+
+	for( int i=0 ; i<MEM_SUBSYSTEM_COUNT ; i++ )
+	{
+		fprintf(logFile, "  %-10s %12lld bytes, peak %12lld, %ld allocations last frame\n",
+			subsystem_name_array[i], subsystem_live_size[i], subsystem_peak_size[i], subsystem_frame_add_count[i]);
+	}
+
+	//----- the accounts with the most memory, biggest first -----//
+
+	int accountCount = account_count;
+	char dumpedFlag[MAX_MEM_ACCOUNT];
+
+	memset( dumpedFlag, 0, sizeof(dumpedFlag) );
+
+	for( int n=0 ; n<DUMP_ACCOUNT_COUNT ; n++ )
+	{
+		int maxAccountId = -1;
+		long long maxSize = 0;
+
+		for( int i=0 ; i<accountCount ; i++ )
+		{
+			long long liveSize = account_array[i].live_size.load(std::memory_order_relaxed);
+
+			if( !dumpedFlag[i] && liveSize > maxSize )
+			{
+				maxSize = liveSize;
+				maxAccountId = i;
+			}
+		}
+
+		if( maxAccountId < 0 )
+			break;
+
+		fprintf(logFile, "  %-24s %12lld bytes in %ld blocks\n",
+			account_array[maxAccountId].file_name ? account_array[maxAccountId].file_name : "(other files)",
+			maxSize, account_array[maxAccountId].live_count.load(std::memory_order_relaxed));
+
+		dumpedFlag[maxAccountId] = 1;
+	}
+
+	close_log(logFile);
+}
+//----------- End of function MemStat::dump -----------//
+
+
+//--------- Begin of function MemStat::draw_profile ---------//
+//
+// Shown with the other profile information when config.show_ai_info
+// is on.
+//
+void MemStat::draw_profile()
+{
+	char str[100];
+	int x = ZOOM_X1+300, y = ZOOM_Y1+30;
+
+	snprintf( str, sizeof(str), "Memory: %lldK, peak %lldK",
+		total_live_size.load(std::memory_order_relaxed) / 1024,
+		total_peak_size.load(std::memory_order_relaxed) / 1024 );
+	font_news.put( x, y, str );
+
+	snprintf( str, sizeof(str), "Allocations/frame: %ld", last_frame_add_count );
+	font_news.put( x, y+=20, str );
+
+	for( int i=0 ; i<MEM_SUBSYSTEM_COUNT ; i++ )
+	{
+		snprintf( str, sizeof(str), "%s: %lldK, peak %lldK, %ld/frame", subsystem_name_array[i],
+			subsystem_live_size[i] / 1024, subsystem_peak_size[i] / 1024, subsystem_frame_add_count[i] );
+		font_news.put( x, y+=20, str );
+	}
+
+	snprintf( str, sizeof(str), "Ambition entities: %llu", Ambition::Control::entityCount() );
+	font_news.put( x, y+=20, str );
+}
+//----------- End of function MemStat::draw_profile -----------//
+
+
+//--------- Begin of static function open_log ---------//
+//
+// Open MEMSTAT.LOG in the config directory for adding to it. It is
+// emptied the first time in a run. stderr is returned if it cannot be
+// opened, so the report is never lost.
+//
+static FILE* open_log()
+{
+	FilePath fullPath(sys.dir_config);
+	FILE* filePtr = NULL;
+
+	fullPath += MEM_LOG_FILE_NAME;
+
+	if( !fullPath.error_flag )
+		filePtr = fopen(fullPath, log_started_flag ? "a" : "w");
+
+	log_started_flag = 1;
+
+	return filePtr ? filePtr : stderr;
+}
+//----------- End of static function open_log -----------//
+
+
+//--------- Begin of static function close_log ---------//
+
+static void close_log(FILE* filePtr)
+{
+	if( filePtr != stderr )
+		fclose(filePtr);
+	else
+		fflush(filePtr);
+}
+//----------- End of static function close_log -----------//
+
+
+//--------- Begin of static function file_subsystem ---------//
+//
+static char file_subsystem(const char* fileName)
+{
+	const char* baseName = fileName;
+
+	for( const char* p=fileName ; *p ; p++ )
+	{
+		if( *p == '/' || *p == '\\' )
+			baseName = p+1;
+	}
+
+	int nameLen = strcspn(baseName, ".");
+
+	if( strncmp(baseName, "ODYNARR", 7) == 0 )
+		return MEM_SUBSYSTEM_DYNARRAY;
+
+	if( strncmp(baseName, "OSPATH", 6) == 0 )
+		return MEM_SUBSYSTEM_SEEK_PATH;
+
+	if( strncmp(baseName, "OVQUEUE", 7) == 0 )
+		return MEM_SUBSYSTEM_VLEN_QUEUE;
+
+	//---- Resource, ResourceDb and the XXXRES files using them ----//
+
+	if( strncmp(baseName, "ORES", 4) == 0 ||
+		 (nameLen > 3 && strncmp(baseName+nameLen-3, "RES", 3) == 0) )
+	{
+		return MEM_SUBSYSTEM_RESOURCE;
+	}
+
+	return MEM_SUBSYSTEM_OTHER;
+}
+//----------- End of static function file_subsystem -----------//
+
+
+//--------- Begin of static function account_add ---------//
+//
+static void account_add(int accountId, unsigned memSize)
+{
+	MemAccount* accountPtr = account_array + accountId;
+
+	accountPtr->live_size.fetch_add(memSize, std::memory_order_relaxed);
+	accountPtr->live_count.fetch_add(1, std::memory_order_relaxed);
+	accountPtr->frame_add_count.fetch_add(1, std::memory_order_relaxed);
+
+	long long totalSize = total_live_size.fetch_add(memSize, std::memory_order_relaxed) + memSize;
+	long long peakSize = total_peak_size.load(std::memory_order_relaxed);
+
+	while( totalSize > peakSize &&
+			 !total_peak_size.compare_exchange_weak(peakSize, totalSize, std::memory_order_relaxed) )
+	{
+	}
+}
+//----------- End of static function account_add -----------//
+
+
+//--------- Begin of static function account_del ---------//
+//
+static void account_del(int accountId, unsigned memSize)
+{
+	MemAccount* accountPtr = account_array + accountId;
+
+	accountPtr->live_size.fetch_sub(memSize, std::memory_order_relaxed);
+	accountPtr->live_count.fetch_sub(1, std::memory_order_relaxed);
+
+	total_live_size.fetch_sub(memSize, std::memory_order_relaxed);
+}
+//----------- End of static function account_del -----------//
@@ -0,0 +1,513 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OMPRESYN.CPP
+//Description : Object MpResync
+
+#include <string.h>
+
+#include "ambition/7kaaInterface/control.hh"
+
+#include <ALL.h>
+#include <OMPRESYN.h>
+#include <OSYS.h>
+#include <OSTR.h>
+#include <OBOX.h>
+#include <OVGA.h>
+#include <OMISC.h>
+#include <OFILE.h>
+#include <OINFO.h>
+#include <OPOWER.h>
+#include <OWORLD.h>
+#include <OCONFIG.h>
+#include <OREMOTE.h>
+#include <OERRCTRL.h>
+#include <ONATIONA.h>
+#include <OSaveGameInfo.h>
+#include <OSaveGameProvider.h>
+#include <dbglog.h>
+#include "gettext.h"
+
+DBGLOG_DEFAULT_CHANNEL(MpResync);
+
+
+//--------- Define constant ---------//
+
+enum { SETTLE_FRAMES = (Remote::MAX_PROCESS_FRAME_DELAY+3)*2,
+		 SEND_TIME_OUT = 30000,
+		 RECEIVE_TIME_OUT = 30000 };
+
+
+//--------- Begin of function MpResync::MpResync ---------//
+//
+MpResync::MpResync()
+{
+	state_buf = NULL;
+	chunk_received_buf = NULL;
+
+	init();
+}
+//----------- End of function MpResync::MpResync -----------//
+
+
+//--------- Begin of function MpResync::~MpResync ---------//
+//
+MpResync::~MpResync()
+{
+	free_state();
+}
+//----------- End of function MpResync::~MpResync -----------//
+
+
+//--------- Begin of function MpResync::init ---------//
+//
+void MpResync::init()
+{
+	request_sent_flag = 0;
+	request_flag = 0;
+	resync_frame = 0;
+	source_nation_recno = 0;
+
+	settle_frame = 0;
+	settle_sync_test_level = 0;
+
+	free_state();
+}
+//----------- End of function MpResync::init -----------//
+
+
+//--------- Begin of function MpResync::process ---------//
+//
+// Called in every loop of the multiplayer game, after the frame has been
+// processed.
+//
+void MpResync::process()
+{
+	if( !remote.is_enable() )
+		return;
+
+	//---- the first human player requests a resync when the game is out of sync ----//
+
+	if( remote.sync_test_level < 0 && !request_sent_flag && !request_flag &&
+		 nation_array.player_recno && is_source() )
+	{
+		send_request();
+	}
+
+	if( request_flag && resync_frame == sys.frame_count )
+		resync_now();
+
+	//------- resume sync testing -------//
+
+	if( settle_frame && sys.frame_count >= settle_frame )
+	{
+		remote.sync_test_level = settle_sync_test_level;
+		settle_frame = 0;
+	}
+}
+//----------- End of function MpResync::process -----------//
+
+
+//--------- Begin of function MpResync::request ---------//
+//
+// Called by MSG_REQUEST_RESYNC, in the same frame on all players.
+//
+// <uint32_t> resyncFrame        - the frame the state is sent in
+// <short>    sourceNationRecno  - the nation of the player sending its state
+//
+void MpResync::request(uint32_t resyncFrame, short sourceNationRecno)
+{
+	if( !remote.is_enable() || request_flag )
+		return;
+
+	request_flag = 1;
+	resync_frame = resyncFrame;
+	source_nation_recno = sourceNationRecno;
+}
+//----------- End of function MpResync::request -----------//
+
+
+//--------- Begin of function MpResync::add_data ---------//
+//
+// Called by MSG_RESYNC_DATA, copies a chunk of the saved game. Chunks
+// are CHUNK_SIZE bytes apart, a chunk received again is ignored.
+//
+// <char*> dataPtr - ResyncDataHeader followed by the data
+//
+void MpResync::add_data(char* dataPtr)
+{
+	ResyncDataHeader* dataHeader = (ResyncDataHeader*) dataPtr;
+
+	if( !request_flag || dataHeader->frame != resync_frame ||
+		 source_nation_recno == nation_array.player_recno )
+	{
+		return;
+	}
+
+	if( !state_buf && dataHeader->state_size > 0 )
+	{
+		state_size           = dataHeader->state_size;
+		chunk_count          = (uint32_t) ((state_size + (uint64_t) CHUNK_SIZE - 1) / CHUNK_SIZE);
+		received_chunk_count = 0;
+		state_buf            = (unsigned char*) mem_add( state_size );
+		chunk_received_buf   = (unsigned char*) mem_add_clear( (chunk_count+7)/8 );
+	}
+
+	//--- the offset and size are checked separately, so that their sum cannot overflow ---//
+
+	uint32_t offset = dataHeader->offset;
+
+	if( !state_buf || dataHeader->state_size != state_size ||
+		 offset >= state_size || offset % CHUNK_SIZE != 0 ||
+		 dataHeader->data_size != MIN((uint32_t) CHUNK_SIZE, state_size-offset) )
+	{
+		ERR("Resync data at offset %u of %u bytes is not a chunk of the state\n", offset, dataHeader->data_size);
+		return;
+	}
+
+	uint32_t chunkId = offset / CHUNK_SIZE;
+
+	if( chunk_received_buf[chunkId/8] & (1 << (chunkId%8)) )
+		return;
+
+	chunk_received_buf[chunkId/8] |= 1 << (chunkId%8);
+	received_chunk_count++;
+
+	memcpy( state_buf + offset, dataPtr + sizeof(ResyncDataHeader), dataHeader->data_size );
+}
+//----------- End of function MpResync::add_data -----------//
+
+
+//--------- Begin of function MpResync::is_source ---------//
+//
+// Returns whether this player is the human player with the lowest
+// nation recno, who sends its state.
+//
+int MpResync::is_source()
+{
+	for( int i=1 ; i<=nation_array.size() ; i++ )
+	{
+		if( nation_array.is_deleted(i) )
+			continue;
+
+		Nation* nationPtr = nation_array[i];
+
+		if( nationPtr->is_own() || nationPtr->is_remote() )
+			return nationPtr->is_own();
+	}
+
+	return 0;
+}
+//----------- End of function MpResync::is_source -----------//
+
+
+//--------- Begin of function MpResync::send_request ---------//
+//
+void MpResync::send_request()
+{
+	// message struct : <uint32_t> frame when the state is sent, <short> nation recno of the player sending it
+
+	char* dataPtr = remote.new_send_queue_msg( MSG_REQUEST_RESYNC, sizeof(uint32_t)+sizeof(short) );
+
+	*(uint32_t*) dataPtr = remote.next_send_frame(nation_array.player_recno, sys.frame_count+remote.process_frame_delay)+2;
+	*(short*) (dataPtr+sizeof(uint32_t)) = nation_array.player_recno;
+
+	request_sent_flag = 1;
+}
+//----------- End of function MpResync::send_request -----------//
+
+
+//--------- Begin of function MpResync::resync_now ---------//
+//
+void MpResync::resync_now()
+{
+	short sourceNationRecno = source_nation_recno;
+	int rc;
+
+	request_flag = 0;
+	request_sent_flag = 0;
+
+	//--- the sender loads the state it has sent as well, so that what is ---//
+	//--- not saved or is rebuilt on loading is the same on all players   ---//
+
+	if( sourceNationRecno == nation_array.player_recno )
+		rc = send_state() && load_state();
+	else
+		rc = receive_state() && load_state();
+
+	free_state();
+
+	if( rc )
+		MSG("Game state of nation %d resynced in frame %u\n", sourceNationRecno, sys.frame_count);
+	else
+		ERR("Resync from nation %d failed in frame %u\n", sourceNationRecno, sys.frame_count);
+
+	//--- the sync test messages sent before the resync compare the old state, ---//
+	//--- so sync testing is suspended until they have been processed         ---//
+
+	settle_sync_test_level = remote.start_sync_test_level;
+	settle_frame = sys.frame_count + SETTLE_FRAMES;
+	remote.sync_test_level = 0;
+}
+//----------- End of function MpResync::resync_now -----------//
+
+
+//--------- Begin of function MpResync::send_state ---------//
+//
+// Saves the game into memory and sends it to all other players. Saved
+// games are compressed already. The saved game is kept in state_file
+// for load_state().
+//
+// return : <int> 1 - sent successfully
+//                0 - not sent
+//
+int MpResync::send_state()
+{
+	//----- save the game, through GameFile so that the Ambition data is included -----//
+
+	if( !state_file.file_create_mem(0, 1) ||		// 0=don't handle error itself, 1=as a saved game file
+		 !SaveGameProvider::save_game_mem(&state_file) )
+	{
+		return 0;
+	}
+
+	state_size = state_file.file_size();
+
+	unsigned char* stateBuf = (unsigned char*) state_file.file_mem_buf();
+	int rc = 1;
+
+	MSG("Sending the game state of %u bytes\n", state_size);
+
+	//-------- send it in chunks --------//
+
+	for( uint32_t offset=0 ; rc && offset<state_size ; offset+=CHUNK_SIZE )
+	{
+		uint32_t dataSize = MIN((uint32_t) CHUNK_SIZE, state_size-offset);
+		RemoteMsg* remoteMsgPtr = remote.new_msg( MSG_RESYNC_DATA, sizeof(ResyncDataHeader)+dataSize );
+		ResyncDataHeader* dataHeader = (ResyncDataHeader*) remoteMsgPtr->data_buf;
+
+		dataHeader->frame       = sys.frame_count;
+		dataHeader->state_size  = state_size;
+		dataHeader->offset      = offset;
+		dataHeader->data_size   = dataSize;
+		memcpy( remoteMsgPtr->data_buf + sizeof(ResyncDataHeader), stateBuf + offset, dataSize );
+
+		//--- when the send queue is full, wait for the other players to acknowledge ---//
+
+		unsigned long timeOut = misc.get_time() + SEND_TIME_OUT;
+
+		while( !remote.send_msg(remoteMsgPtr) )
+		{
+			if( sys.signal_exit_flag || misc.get_time() > timeOut )
+			{
+				rc = 0;
+				break;
+			}
+
+			sys.yield();
+			ec_remote.re_transmit();
+		}
+
+		remote.free_msg(remoteMsgPtr);
+	}
+
+	return rc;
+}
+//----------- End of function MpResync::send_state -----------//
+
+
+//--------- Begin of function MpResync::receive_state ---------//
+//
+// Waits until all chunks of the state have been received.
+//
+// return : <int> 1 - received successfully
+//                0 - the sender is lost or has stopped sending
+//
+int MpResync::receive_state()
+{
+	String str;
+
+	snprintf( str, MAX_STR_LEN+1, _("Receiving the game from %s's Kingdom..."),
+		nation_array.is_deleted(source_nation_recno) ? "" : nation_array[source_nation_recno]->king_name(1) );
+
+	box.tell(str);
+
+	unsigned long timeOut = misc.get_time() + RECEIVE_TIME_OUT;
+	uint32_t lastReceivedCount = 0;
+	int rc = 1;
+
+	while( !state_buf || received_chunk_count < chunk_count )
+	{
+		if( sys.signal_exit_flag || misc.get_time() > timeOut ||
+			 !ec_remote.is_player_valid((char) source_nation_recno) )
+		{
+			rc = 0;
+			break;
+		}
+
+		vga_front.unlock_buf();
+		Ambition::Control::delayFrame();
+		vga_front.lock_buf();
+
+		sys.yield();
+		remote.process_specific_msg(MSG_RESYNC_DATA);
+
+		if( state_buf && received_chunk_count != lastReceivedCount )
+		{
+			lastReceivedCount = received_chunk_count;
+			timeOut = misc.get_time() + RECEIVE_TIME_OUT;
+		}
+	}
+
+	box.close();
+
+	return rc;
+}
+//----------- End of function MpResync::receive_state -----------//
+
+
+//--------- Begin of function MpResync::load_state ---------//
+//
+// Loads the received or sent state. What belongs to this player only,
+// its nation, the explored map and the preferences, is kept.
+//
+// return : <int> 1 - loaded successfully
+//                0 - not loaded
+//
+int MpResync::load_state()
+{
+	//---- the received chunks are read as a memory file, the sent game from the start ----//
+
+	if( state_buf )
+	{
+		state_file.file_open_mem( (char*) state_buf, state_size, 0, 1 );		// 0=don't handle error itself, 1=as a saved game file
+		state_buf = NULL;
+	}
+	else
+	{
+		state_file.file_seek(0);
+	}
+
+	//------- keep what is local to this player -------//
+
+	short ownNationRecno = nation_array.player_recno;
+	char  nextFrameReady[MAX_NATION+1];
+	Config localConfig = config;
+
+	memset( nextFrameReady, 0, sizeof(nextFrameReady) );
+
+	for( int i=nation_array.size() ; i>0 ; i-- )
+	{
+		if( !nation_array.is_deleted(i) )
+			nextFrameReady[i] = nation_array[i]->next_frame_ready;
+	}
+
+	int xLocCount = MAX_WORLD_X_LOC, yLocCount = MAX_WORLD_Y_LOC;
+	unsigned char* visitLevelBuf = (unsigned char*) mem_add( xLocCount*yLocCount );
+
+	for( int i=xLocCount*yLocCount-1 ; i>=0 ; i-- )
+		visitLevelBuf[i] = world.loc_matrix[i].visit_level;
+
+	//--------- load the game ---------//
+
+	SaveGameInfo saveGameInfo;
+
+	int rc = SaveGameProvider::load_game_mem(&state_file, &saveGameInfo);
+
+	free_state();
+
+	if( rc <= 0 )
+	{
+		mem_del(visitLevelBuf);
+
+		if( rc < 0 )						// partially loaded, the game cannot continue
+			sys.signal_exit_flag = 1;
+
+		return 0;
+	}
+
+	//------- restore what is local to this player -------//
+
+	config.change_preference(localConfig);
+
+	if( xLocCount == MAX_WORLD_X_LOC && yLocCount == MAX_WORLD_Y_LOC )
+	{
+		for( int i=xLocCount*yLocCount-1 ; i>=0 ; i-- )
+			world.loc_matrix[i].visit_level = visitLevelBuf[i];
+	}
+
+	mem_del(visitLevelBuf);
+
+	for( int i=nation_array.size() ; i>0 ; i-- )
+	{
+		if( nation_array.is_deleted(i) )
+			continue;
+
+		Nation* nationPtr = nation_array[i];
+
+		if( i == ownNationRecno )
+			nationPtr->nation_type = NATION_OWN;
+		else if( nationPtr->is_own() )
+			nationPtr->nation_type = NATION_REMOTE;
+
+		if( i <= MAX_NATION )
+			nationPtr->next_frame_ready = nextFrameReady[i];
+	}
+
+	if( ownNationRecno && nation_array.is_deleted(ownNationRecno) )
+		ownNationRecno = 0;
+
+	nation_array.player_recno = ownNationRecno;
+	nation_array.player_ptr = ownNationRecno ? nation_array[ownNationRecno] : NULL;
+
+	info.viewing_nation_recno = ownNationRecno;
+	info.default_viewing_nation_recno = ownNationRecno;
+
+	power.reset_selection();
+	sys.need_redraw_flag = 1;
+
+	return 1;
+}
+//----------- End of function MpResync::load_state -----------//
+
+
+//--------- Begin of function MpResync::free_state ---------//
+//
+void MpResync::free_state()
+{
+	if( state_buf )
+	{
+		mem_del(state_buf);
+		state_buf = NULL;
+	}
+
+	if( chunk_received_buf )
+	{
+		mem_del(chunk_received_buf);
+		chunk_received_buf = NULL;
+	}
+
+	state_file.file_close();
+
+	state_size = 0;
+	chunk_count = 0;
+	received_chunk_count = 0;
+}
+//----------- End of function MpResync::free_state -----------//
@@ -31,6 +31,7 @@
 #include <ONATIONA.h>
 #include <OREMOTE.h>
 #include <OLOG.h>
+#include <OFLTREC.h>
 #include <ConfigAdv.h>
 
 //### begin alex 22/9 ###//
@@ -348,6 +349,7 @@ void NationArray::process()
 				LOG_MSG( "begin process_ai");
 				nationPtr->process_ai();
 				LOG_MSG( "end process_ai");
+				FLIGHT_REC("nation.process_ai", i);
 				LOG_MSG(misc.get_random_seed());
 
 				#ifdef DEBUG
@@ -0,0 +1,212 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : ONATVIEW.CPP
+//Description : Object NationViewArray
+
+#include <algorithm>
+#include <ONATVIEW.h>
+#include <OUNIT.h>
+#include <OFIRM.h>
+#include <OFIRMA.h>
+#include <OTOWN.h>
+
+//----------- Define static functions ----------//
+
+static void link_recno(std::vector<short>& recnoList, int recNo);
+static void unlink_recno(std::vector<short>& recnoList, int recNo);
+static int  is_general(int rankId)	{ return rankId==RANK_GENERAL || rankId==RANK_KING; }
+
+
+//--------- Begin of function NationView::clear ---------//
+//
+void NationView::clear()
+{
+	general_list.clear();
+	town_list.clear();
+
+	for( int i=0 ; i<MAX_UNIT_TYPE ; i++ )
+		unit_list[i].clear();
+
+	for( int i=0 ; i<MAX_FIRM_TYPE ; i++ )
+		firm_list[i].clear();
+}
+//----------- End of function NationView::clear -----------//
+
+
+//--------- Begin of function NationViewArray::init ---------//
+//
+void NationViewArray::init()
+{
+	deinit();
+}
+//----------- End of function NationViewArray::init -----------//
+
+
+//--------- Begin of function NationViewArray::deinit ---------//
+//
+void NationViewArray::deinit()
+{
+	for( int i=0 ; i<=MAX_NATION ; i++ )
+		view_array[i].clear();
+}
+//----------- End of function NationViewArray::deinit -----------//
+
+
+//--------- Begin of function NationViewArray::operator[] ---------//
+//
+// <int> nationRecno - recno of the nation, 0 for independents.
+//
+NationView* NationViewArray::operator[](int nationRecno)
+{
+	err_when( nationRecno<0 || nationRecno>MAX_NATION );
+
+	return view_array+nationRecno;
+}
+//----------- End of function NationViewArray::operator[] -----------//
+
+
+//--------- Begin of function NationViewArray::add_unit ---------//
+//
+void NationViewArray::add_unit(int unitRecno, int nationRecno, int unitId, int rankId)
+{
+	NationView* nationView = operator[](nationRecno);
+
+	link_recno( nationView->units(unitId), unitRecno );
+
+	if( is_general(rankId) )
+		link_recno( nationView->general_list, unitRecno );
+}
+//----------- End of function NationViewArray::add_unit -----------//
+
+
+//--------- Begin of function NationViewArray::del_unit ---------//
+//
+void NationViewArray::del_unit(int unitRecno, int nationRecno, int unitId, int rankId)
+{
+	NationView* nationView = operator[](nationRecno);
+
+	unlink_recno( nationView->units(unitId), unitRecno );
+
+	if( is_general(rankId) )
+		unlink_recno( nationView->general_list, unitRecno );
+}
+//----------- End of function NationViewArray::del_unit -----------//
+
+
+//--------- Begin of function NationViewArray::add_firm ---------//
+//
+void NationViewArray::add_firm(int firmRecno, int nationRecno, int firmId)
+{
+	link_recno( operator[](nationRecno)->firms(firmId), firmRecno );
+}
+//----------- End of function NationViewArray::add_firm -----------//
+
+
+//--------- Begin of function NationViewArray::del_firm ---------//
+//
+void NationViewArray::del_firm(int firmRecno, int nationRecno, int firmId)
+{
+	unlink_recno( operator[](nationRecno)->firms(firmId), firmRecno );
+}
+//----------- End of function NationViewArray::del_firm -----------//
+
+
+//--------- Begin of function NationViewArray::add_town ---------//
+//
+void NationViewArray::add_town(int townRecno, int nationRecno)
+{
+	link_recno( operator[](nationRecno)->town_list, townRecno );
+}
+//----------- End of function NationViewArray::add_town -----------//
+
+
+//--------- Begin of function NationViewArray::del_town ---------//
+//
+void NationViewArray::del_town(int townRecno, int nationRecno)
+{
+	unlink_recno( operator[](nationRecno)->town_list, townRecno );
+}
+//----------- End of function NationViewArray::del_town -----------//
+
+
+//------- Begin of function NationViewArray::recreate_after_load -------//
+//
+// Units, firms and towns read from a saved game are not init()'ed,
+// so the lists have to be built again from the arrays.
+//
+void NationViewArray::recreate_after_load()
+{
+	deinit();
+
+	int i;
+
+	for( i=1 ; i<=unit_array.size() ; i++ )
+	{
+		Unit* unitPtr = (Unit*) unit_array.get_ptr(i);		// don't use is_deleted() as it filters out units that are currently dying
+
+		if( unitPtr )
+			add_unit( i, unitPtr->nation_recno, unitPtr->unit_id, unitPtr->rank_id );
+	}
+
+	for( i=1 ; i<=firm_array.size() ; i++ )
+	{
+		if( firm_array.is_deleted(i) )
+			continue;
+
+		Firm* firmPtr = firm_array[i];
+
+		add_firm( i, firmPtr->nation_recno, firmPtr->firm_id );
+	}
+
+	for( i=1 ; i<=town_array.size() ; i++ )
+	{
+		Town* townPtr = (Town*) town_array.get_ptr(i);
+
+		if( townPtr )
+			add_town( i, townPtr->nation_recno );
+	}
+}
+//------- End of function NationViewArray::recreate_after_load -------//
+
+
+//-------- Begin of static function link_recno --------//
+//
+static void link_recno(std::vector<short>& recnoList, int recNo)
+{
+	std::vector<short>::iterator it = std::lower_bound(recnoList.begin(), recnoList.end(), recNo);
+
+	err_when( it != recnoList.end() && *it == recNo );
+
+	recnoList.insert(it, (short) recNo);
+}
+//----------- End of static function link_recno -----------//
+
+
+//-------- Begin of static function unlink_recno --------//
+//
+static void unlink_recno(std::vector<short>& recnoList, int recNo)
+{
+	std::vector<short>::iterator it = std::lower_bound(recnoList.begin(), recnoList.end(), recNo);
+
+	if( it != recnoList.end() && *it == recNo )
+		recnoList.erase(it);
+}
+//----------- End of static function unlink_recno -----------//
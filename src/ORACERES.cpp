@@ -24,6 +24,7 @@
 #include <OGAMESET.h>
 #include <OUNITRES.h>
 #include <ORACERES.h>
+#include <ORESBAKE.h>
 
 //---------- #define constant ------------//
 
@@ -144,9 +145,19 @@ void RaceRes::load_name()
 	RaceNameRec *raceNameRec;
 	RaceName		*raceName;
 	int      	i, j;
-	Database 	*dbRaceName = game_set.open_db(RACE_NAME_DB);
+	Database 	*dbRaceName = NULL;
+	long			bakedCount = res_bake.find_table(RACE_NAME_DB, sizeof(RaceName));
+
+	if( bakedCount < 0 )		// the baked records are not up to date
+	{
+		dbRaceName = game_set.open_db(RACE_NAME_DB);
+		name_count = (short) dbRaceName->rec_count();
+	}
+	else
+	{
+		name_count = (short) bakedCount;
+	}
 
-	name_count = (short) dbRaceName->rec_count();
 	name_array = (RaceName*) mem_add( sizeof(RaceName)*name_count );
 	name_used_array = (unsigned char*) mem_add( sizeof(name_used_array[0])*name_count );
 
@@ -154,16 +165,32 @@ void RaceRes::load_name()
 
 	//------ read in RaceName info array -------//
 
+	if( !dbRaceName )
+	{
+		res_bake.copy_table(RACE_NAME_DB, name_array);
+	}
+	else
+	{
+		for( i=1 ; i<=name_count ; i++ )
+		{
+			raceNameRec = (RaceNameRec*) dbRaceName->read(i);
+			raceName    = name_array+i-1;
+
+			misc.rtrim_fld( raceName->name, raceNameRec->name, raceNameRec->NAME_LEN );
+			// The default STD.SET uses a different code page than the used fonts.
+			misc.dos_encoding_to_win(raceName->name, raceName->NAME_LEN);
+		}
+
+		res_bake.add_table(RACE_NAME_DB, dbRaceName, name_array, sizeof(RaceName));
+	}
+
+	//------ get the first and last names of each race -------//
+
 	int raceId=0, isFirstName;
 
 	for( i=1 ; i<=name_count ; i++ )
 	{
-		raceNameRec = (RaceNameRec*) dbRaceName->read(i);
-		raceName    = name_array+i-1;
-
-		misc.rtrim_fld( raceName->name, raceNameRec->name, raceNameRec->NAME_LEN );
-		// The default STD.SET uses a different code page than the used fonts.
-		misc.dos_encoding_to_win(raceName->name, raceName->NAME_LEN);
+		raceName = name_array+i-1;
 
 		if( raceName->name[0]=='@' )
 		{
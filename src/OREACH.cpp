@@ -0,0 +1,313 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OREACH.CPP
+//Description : Object ReachMap
+
+#include <ALL.h>
+#include <OPASSMAP.h>
+#include <OREACH.h>
+
+//------- Define static vars -------//
+
+// the eight adjacent locations, in the order going round the location
+static int ring_x_offset[8] = {  0,  1, 1, 1, 0, -1, -1, -1 };
+static int ring_y_offset[8] = { -1, -1, 0, 1, 1,  1,  0, -1 };
+
+//------- Begin of function ReachMap::ReachMap -------//
+
+ReachMap::ReachMap()
+{
+	pass_map = NULL;
+	map_width = map_height = 0;
+	loc_conn_id = NULL;
+	conn_parent = NULL;
+	conn_count = 0;
+	relabel_flag = 0;
+}
+//-------- End of function ReachMap::ReachMap --------//
+
+
+//------- Begin of function ReachMap::init -------//
+//
+// The areas are labelled before the first query.
+//
+void ReachMap::init(PassMap* passMap, int mapWidth, int mapHeight)
+{
+	int locCount = mapWidth * mapHeight;
+
+	pass_map   = passMap;
+	map_width  = mapWidth;
+	map_height = mapHeight;
+
+	loc_conn_id = (int*) mem_resize( loc_conn_id, locCount * sizeof(int) );
+	conn_parent = (int*) mem_resize( conn_parent, (locCount+1) * sizeof(int) );		// there cannot be more areas than locations
+
+	conn_count   = 0;
+	relabel_flag = 1;
+}
+//-------- End of function ReachMap::init --------//
+
+
+//------- Begin of function ReachMap::deinit -------//
+
+void ReachMap::deinit()
+{
+	if( loc_conn_id )
+	{
+		mem_del( loc_conn_id );
+		loc_conn_id = NULL;
+	}
+
+	if( conn_parent )
+	{
+		mem_del( conn_parent );
+		conn_parent = NULL;
+	}
+
+	pass_map = NULL;
+	conn_count = 0;
+}
+//-------- End of function ReachMap::deinit --------//
+
+
+//------- Begin of function ReachMap::pass_type -------//
+//
+// Return PASS_LAND, PASS_SEA or 0. A location both walkable and
+// sailable counts as land, like Location::region_type().
+//
+int ReachMap::pass_type(int passBits)
+{
+	if( passBits & PASS_LAND )
+		return PASS_LAND;
+
+	return passBits & PASS_SEA;
+}
+//-------- End of function ReachMap::pass_type --------//
+
+
+//------- Begin of function ReachMap::loc_opened -------//
+//
+// Called after the location has become walkable or sailable.
+//
+void ReachMap::loc_opened(int locOffset)
+{
+	if( relabel_flag || !loc_conn_id )
+		return;
+
+	int passType = pass_type(pass_map->get(locOffset));
+	int xLoc = locOffset % map_width;
+	int yLoc = locOffset / map_width;
+	int connId = 0;
+
+	for( int i=0 ; i<8 ; i++ )
+	{
+		int x = xLoc + ring_x_offset[i];
+		int y = yLoc + ring_y_offset[i];
+
+		if( x<0 || x>=map_width || y<0 || y>=map_height )
+			continue;
+
+		int adjOffset = y*map_width + x;
+
+		if( pass_type(pass_map->get(adjOffset)) != passType )
+			continue;
+
+		err_when( !loc_conn_id[adjOffset] );
+
+		if( connId )
+			join_conn(connId, loc_conn_id[adjOffset]);
+		else
+			connId = loc_conn_id[adjOffset];
+	}
+
+	if( !connId )		// a new area on its own
+	{
+		if( conn_count >= map_width*map_height )
+		{
+			relabel_flag = 1;
+			return;
+		}
+
+		connId = ++conn_count;
+		conn_parent[connId] = connId;
+	}
+
+	loc_conn_id[locOffset] = connId;
+}
+//-------- End of function ReachMap::loc_opened --------//
+
+
+//------- Begin of function ReachMap::loc_closed -------//
+//
+// Called after the location has become impassable.
+//
+// If the passable locations around it are all in one run going round
+// it, they are still connected without it. Otherwise it may have split
+// its area.
+//
+void ReachMap::loc_closed(int locOffset, int oldPassType)
+{
+	if( relabel_flag || !loc_conn_id )
+		return;
+
+	loc_conn_id[locOffset] = 0;
+
+	int xLoc = locOffset % map_width;
+	int yLoc = locOffset / map_width;
+	int runCount = 0;
+	int firstPass = 0, lastPass = 0;
+
+	for( int i=0 ; i<8 ; i++ )
+	{
+		int x = xLoc + ring_x_offset[i];
+		int y = yLoc + ring_y_offset[i];
+		int isPass = x>=0 && x<map_width && y>=0 && y<map_height &&
+						 pass_type(pass_map->get(y*map_width + x)) == oldPassType;
+
+		if( i==0 )
+			firstPass = isPass;
+		else if( isPass && !lastPass )
+			runCount++;
+
+		lastPass = isPass;
+	}
+
+	if( firstPass && !lastPass )		// the run starting at the first location
+		runCount++;
+
+	if( runCount > 1 )
+		relabel_flag = 1;
+}
+//-------- End of function ReachMap::loc_closed --------//
+
+
+//------- Begin of function ReachMap::get_conn -------//
+//
+// <int> passType = PASS_LAND or PASS_SEA
+//
+// Return the id. of the connected area of the location, 0 if the
+// location is not of the given pass type. Two locations can reach each
+// other when they have the same id.
+//
+int ReachMap::get_conn(int xLoc, int yLoc, int passType)
+{
+	err_when( !loc_conn_id );
+
+	if( relabel_flag )
+		relabel();
+
+	int locOffset = yLoc*map_width + xLoc;
+
+	if( pass_type(pass_map->get(locOffset)) != passType )
+		return 0;
+
+	return find_conn( loc_conn_id[locOffset] );
+}
+//-------- End of function ReachMap::get_conn --------//
+
+
+//------- Begin of function ReachMap::relabel -------//
+//
+// Label the connected areas of the whole map in one pass, joining the
+// areas of the locations before and above.
+//
+void ReachMap::relabel()
+{
+	conn_count = 0;
+
+	int locOffset = 0;
+
+	for( int yLoc=0 ; yLoc<map_height ; yLoc++ )
+	{
+		for( int xLoc=0 ; xLoc<map_width ; xLoc++, locOffset++ )
+		{
+			int passType = pass_type(pass_map->get(locOffset));
+
+			if( !passType )
+			{
+				loc_conn_id[locOffset] = 0;
+				continue;
+			}
+
+			int connId = 0;
+
+			for( int i=6 ; i<10 ; i++ )		// W, NW, N and NE, the ones labelled already
+			{
+				int x = xLoc + ring_x_offset[i&7];
+				int y = yLoc + ring_y_offset[i&7];
+
+				if( x<0 || x>=map_width || y<0 )
+					continue;
+
+				int adjOffset = y*map_width + x;
+
+				if( pass_type(pass_map->get(adjOffset)) != passType )
+					continue;
+
+				if( connId )
+					join_conn(connId, loc_conn_id[adjOffset]);
+				else
+					connId = loc_conn_id[adjOffset];
+			}
+
+			if( !connId )
+			{
+				connId = ++conn_count;
+				conn_parent[connId] = connId;
+			}
+
+			loc_conn_id[locOffset] = connId;
+		}
+	}
+
+	relabel_flag = 0;
+}
+//-------- End of function ReachMap::relabel --------//
+
+
+//------- Begin of function ReachMap::find_conn -------//
+
+int ReachMap::find_conn(int connId)
+{
+	while( conn_parent[connId] != connId )
+	{
+		conn_parent[connId] = conn_parent[conn_parent[connId]];		// halve the path on the way
+		connId = conn_parent[connId];
+	}
+
+	return connId;
+}
+//-------- End of function ReachMap::find_conn --------//
+
+
+//------- Begin of function ReachMap::join_conn -------//
+
+void ReachMap::join_conn(int connId1, int connId2)
+{
+	connId1 = find_conn(connId1);
+	connId2 = find_conn(connId2);
+
+	if( connId1 < connId2 )
+		conn_parent[connId2] = connId1;
+	else if( connId2 < connId1 )
+		conn_parent[connId1] = connId2;
+}
+//-------- End of function ReachMap::join_conn --------//
@@ -51,6 +51,7 @@ Remote::Remote()
 	// ###### patch begin Gilbert 22/1 #######//
 	sync_test_level = 0;			// 0=disable, bit0= random seed, bit1=crc, bit7=error encountered
 	// ###### patch end Gilbert 22/1 #######//
+	start_sync_test_level = 0;
 }
 //--------- End of function Remote::Remote ----------//
 
@@ -89,6 +90,7 @@ void Remote::init(MultiPlayer *mp)
 	if( config_adv.remote_compare_object_crc || misc.is_file_exist("SYNC2.SYS") )
 		sync_test_level |= 2;
 	// ###### patch end Gilbert 22/1 #######//
+	start_sync_test_level = sync_test_level;
 
 	reset_process_frame_delay();
 
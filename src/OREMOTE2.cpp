@@ -114,7 +114,9 @@ void Remote::free_msg(RemoteMsg* remoteMsgPtr)
 // ^                           ^
 // | Allocate starts here      | return variable here to the client function
 //
-void Remote::send_msg(RemoteMsg* remoteMsgPtr, uint32_t receiverId)
+// return : <int> 1 - sent, 0 - not sent, e.g. the send queue is full
+//
+int Remote::send_msg(RemoteMsg* remoteMsgPtr, uint32_t receiverId)
 {
 	if( handle_vga_lock )
 		vga_front.temp_unlock();
@@ -124,12 +126,14 @@ void Remote::send_msg(RemoteMsg* remoteMsgPtr, uint32_t receiverId)
    int msgSize = *(short *)memPtr + sizeof(short);
 
 	// mp_ptr->send( receiverId, memPtr, msgSize );
-	ec_remote.send( ec_remote.get_ec_player_id(receiverId), memPtr, msgSize);
+	int rc = ec_remote.send( ec_remote.get_ec_player_id(receiverId), memPtr, msgSize) > 0;
 
    packet_send_count++;
 
    if( handle_vga_lock )
       vga_front.temp_restore_lock();
+
+	return rc;
 }
 //--------- End of function Remote::send_msg ---------//
 
@@ -44,6 +44,8 @@
 #include <OSPY.h>
 #include <OTALKRES.h>
 #include <OCRC_STO.h>
+#include <OFLTREC.h>
+#include <OMPRESYN.h>
 #include <gettext.h>
 
 //---------------- Define variable type ---------------//
@@ -184,6 +186,8 @@ static MsgProcessFP msg_process_function_array[] =
 	&RemoteMsg::ship_copy_route,
 	&RemoteMsg::firm_request_builder,
 	&RemoteMsg::market_switch_restock,
+	&RemoteMsg::request_resync,
+	&RemoteMsg::resync_data,
 };
 
 //---------- Declare static functions ----------//
@@ -203,6 +207,8 @@ void RemoteMsg::process_msg()
 
 	MsgProcessFP msgProcessFP = msg_process_function_array[id-FIRST_REMOTE_MSG_ID];
 
+	FLIGHT_REC("remote_msg.process_msg", id);
+
 	(this->*msgProcessFP)();   // call the corrsponding function to return the news process_msg
 }
 //------- End of function RemoteMsg::process_msg -----//
@@ -464,6 +470,7 @@ void RemoteMsg::tell_random_seed()
 //			long_log = NULL;
 #endif
 			LOG_DUMP;
+			flight_recorder.dump("random seed mismatch");
 			if( (remote.sync_test_level & 1) && (remote.sync_test_level >= 0) )
 			{
 				remote.sync_test_level = ~1;	// signal error encountered
@@ -3028,3 +3035,23 @@ void RemoteMsg::market_switch_restock()
 	}
 }
 // ------- End of function RemoteMsg::switch_restock ---------//
+
+
+// ------- Begin of function RemoteMsg::request_resync ---------//
+void RemoteMsg::request_resync()
+{
+	err_when(id != MSG_REQUEST_RESYNC);
+	// packet structure : <uint32_t> frame when the state is sent, <short> nation recno of the player sending it
+	mp_resync.request( *(uint32_t *)data_buf, *(short *)(data_buf+sizeof(uint32_t)) );
+}
+// ------- End of function RemoteMsg::request_resync ---------//
+
+
+// ------- Begin of function RemoteMsg::resync_data ---------//
+void RemoteMsg::resync_data()
+{
+	err_when(id != MSG_RESYNC_DATA);
+	// packet structure : <ResyncDataHeader> <data>
+	mp_resync.add_data(data_buf);
+}
+// ------- End of function RemoteMsg::resync_data ---------//
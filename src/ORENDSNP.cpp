@@ -0,0 +1,202 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : ORENDSNP.CPP
+//Description : Object RenderSnapshot
+
+#include <stdlib.h>
+#include "ambition/7kaaInterface/config.hh"
+#include <ALL.h>
+#include <OMISC.h>
+#include <OUNIT.h>
+#include <ORENDSNP.h>
+
+//------- Begin of function RenderSnapshot::RenderSnapshot -------//
+
+RenderSnapshot::RenderSnapshot()
+{
+	prev_pos_array = NULL;
+	cur_pos_array = NULL;
+	pos_count = prev_pos_count = 0;
+
+	take_time = 0;
+	frame_ms = 0;
+	take_count = 0;
+
+	draw_ratio = 256;
+	saved_x = saved_y = 0;
+}
+//-------- End of function RenderSnapshot::RenderSnapshot --------//
+
+
+//------- Begin of function RenderSnapshot::deinit -------//
+
+void RenderSnapshot::deinit()
+{
+	if( prev_pos_array )
+	{
+		mem_del( prev_pos_array );
+		prev_pos_array = NULL;
+	}
+
+	if( cur_pos_array )
+	{
+		mem_del( cur_pos_array );
+		cur_pos_array = NULL;
+	}
+
+	pos_count = prev_pos_count = 0;
+	take_count = 0;
+	draw_ratio = 256;
+}
+//-------- End of function RenderSnapshot::deinit --------//
+
+
+//------- Begin of function RenderSnapshot::take -------//
+//
+// Called by Sys::process() after the frame is processed and before it
+// is displayed.
+//
+void RenderSnapshot::take()
+{
+	//------ the current positions become the previous ones ------//
+
+	RenderPos* posArray = prev_pos_array;
+
+	prev_pos_array = cur_pos_array;
+	prev_pos_count = pos_count;
+
+	pos_count = unit_array.size();
+	cur_pos_array = (RenderPos*) mem_resize( posArray, MAX(pos_count, 1) * sizeof(RenderPos) );
+
+	//------ get the positions of the units on the map ------//
+
+	RenderPos* posPtr = cur_pos_array;
+
+	for( int i=1 ; i<=pos_count ; i++, posPtr++ )
+	{
+		if( unit_array.is_deleted(i) )
+		{
+			posPtr->x = posPtr->y = -1;
+			continue;
+		}
+
+		Unit* unitPtr = unit_array[i];
+
+		posPtr->x = unitPtr->cur_x;		// -1 if it is not on the map
+		posPtr->y = unitPtr->cur_y;
+	}
+
+	uint32_t curTime = misc.get_time();
+
+	frame_ms  = take_count ? curTime - take_time : 0;
+	take_time = curTime;
+	take_count++;
+
+	draw_ratio = 0;
+}
+//-------- End of function RenderSnapshot::take --------//
+
+
+//------- Begin of function RenderSnapshot::begin_draw -------//
+//
+// Called before the map is drawn, to set how far between the previous
+// and the current frame the units are drawn.
+//
+void RenderSnapshot::begin_draw()
+{
+	if( !Ambition::Config::enhancementsAvailable() ||		// the map is only drawn once a frame
+		 take_count < 2 || frame_ms < RENDER_MIN_FRAME_MS )
+	{
+		draw_ratio = 256;
+		return;
+	}
+
+	uint32_t passedTime = misc.get_time() - take_time;
+
+	if( passedTime >= frame_ms )
+		draw_ratio = 256;
+	else
+		draw_ratio = passedTime * 256 / frame_ms;
+}
+//-------- End of function RenderSnapshot::begin_draw --------//
+
+
+//------- Begin of function RenderSnapshot::shift -------//
+//
+// Move the unit to where it is to be drawn. unshift() must be called
+// right after it is drawn.
+//
+void RenderSnapshot::shift(Sprite* spritePtr)
+{
+	saved_x = spritePtr->cur_x;
+	saved_y = spritePtr->cur_y;
+
+	int spriteRecno = spritePtr->sprite_recno;
+
+	if( draw_ratio >= 256 || spriteRecno < 1 ||
+		 spriteRecno > pos_count || spriteRecno > prev_pos_count )
+	{
+		return;
+	}
+
+	RenderPos* curPos  = cur_pos_array + spriteRecno - 1;
+	RenderPos* prevPos = prev_pos_array + spriteRecno - 1;
+
+	if( prevPos->x < 0 || curPos->x != saved_x || curPos->y != saved_y )		// not on the map in the previous frame, or moved since the current one was taken
+		return;
+
+	int moveX = prevPos->x - curPos->x;
+	int moveY = prevPos->y - curPos->y;
+
+	if( abs(moveX) > RENDER_MAX_MOVE || abs(moveY) > RENDER_MAX_MOVE )
+		return;
+
+	spritePtr->cur_x += moveX * (256-draw_ratio) / 256;
+	spritePtr->cur_y += moveY * (256-draw_ratio) / 256;
+}
+//-------- End of function RenderSnapshot::shift --------//
+
+
+//------- Begin of function RenderSnapshot::unshift -------//
+
+void RenderSnapshot::unshift(Sprite* spritePtr)
+{
+	spritePtr->cur_x = saved_x;
+	spritePtr->cur_y = saved_y;
+}
+//-------- End of function RenderSnapshot::unshift --------//
+
+
+//------- Begin of function RenderSnapshot::del_unit -------//
+//
+// Called when a unit is deleted, so that a new unit given the same
+// recno is not drawn walking from where the deleted one was.
+//
+void RenderSnapshot::del_unit(int unitRecno)
+{
+	if( unitRecno >= 1 && unitRecno <= pos_count )
+		cur_pos_array[unitRecno-1].x = -1;
+
+	if( unitRecno >= 1 && unitRecno <= prev_pos_count )
+		prev_pos_array[unitRecno-1].x = -1;
+}
+//-------- End of function RenderSnapshot::del_unit --------//
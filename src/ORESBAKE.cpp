@@ -0,0 +1,439 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : ORESBAKE.CPP
+//Description : Object ResourceBake
+
+#include <string.h>
+#include <ALL.h>
+#include <ODB.h>
+#include <ODIR.h>
+#include <OFILE.h>
+#include <OMISC.h>
+#include <OGAMESET.h>
+#include <OSYS.h>
+#include <FilePath.h>
+#include <ORESBAKE.h>
+#include <dbglog.h>
+
+DBGLOG_DEFAULT_CHANNEL(ResourceBake);
+
+static const char res_bake_magic[4] = { '7', 'K', 'R', 'B' };
+
+//------- Begin of function ResourceBake::ResourceBake -------//
+
+ResourceBake::ResourceBake()
+{
+	init_flag = 0;
+	changed_flag = 0;
+	file_buf = NULL;
+	table_count = 0;
+
+	memset( table_array, 0, sizeof(table_array) );
+
+	hit_count = miss_count = 0;
+
+	set_file_name[0] = '\0';
+	set_mod_time = 0;
+	set_file_size = 0;
+}
+//-------- End of function ResourceBake::ResourceBake --------//
+
+
+//------- Begin of function ResourceBake::init -------//
+//
+// Read in RESBAKE.DAT. A missing or out of date file leaves no tables,
+// they are added as they are parsed.
+//
+void ResourceBake::init()
+{
+	deinit();
+
+	if( !read_file() )
+	{
+		for( int i=0 ; i<table_count ; i++ )
+			free_table( table_array+i );
+
+		table_count = 0;
+
+		if( file_buf )
+		{
+			mem_del( file_buf );
+			file_buf = NULL;
+		}
+	}
+
+	init_flag = 1;
+}
+//-------- End of function ResourceBake::init --------//
+
+
+//------- Begin of function ResourceBake::deinit -------//
+
+void ResourceBake::deinit()
+{
+	if( !init_flag )
+		return;
+
+	if( hit_count || miss_count )
+		MSG("Baked resources: %lu tables copied, %lu tables parsed\n", hit_count, miss_count);
+
+	for( int i=0 ; i<table_count ; i++ )
+		free_table( table_array+i );
+
+	table_count = 0;
+
+	if( file_buf )
+	{
+		mem_del( file_buf );
+		file_buf = NULL;
+	}
+
+	changed_flag = 0;
+	hit_count = miss_count = 0;
+	set_file_name[0] = '\0';
+	init_flag = 0;
+}
+//-------- End of function ResourceBake::deinit --------//
+
+
+//------- Begin of function ResourceBake::read_file -------//
+//
+// return : <int> 1 - the file is read and its tables are usable
+//                0 - the file is missing, of another version or damaged
+//
+int ResourceBake::read_file()
+{
+	FilePath full_path(sys.dir_config);
+	File file;
+
+	full_path += RES_BAKE_FILE_NAME;
+	if( full_path.error_flag )
+		return 0;
+
+	if( !misc.is_file_exist(full_path) )
+		return 0;
+
+	if( !file.file_open(full_path, 0, 1) )		// 0=don't handle error itself
+		return 0;
+
+	long fileSize = file.file_size();
+
+	if( fileSize < (long) sizeof(ResBakeFileHeader) )
+	{
+		file.file_close();
+		return 0;
+	}
+
+	file_buf = (char*) mem_add( fileSize );
+
+	int rc = file.file_read( file_buf, fileSize );
+
+	file.file_close();
+
+	if( !rc )
+		return 0;
+
+	//------- check the header -------//
+
+	ResBakeFileHeader* fileHeader = (ResBakeFileHeader*) file_buf;
+
+	if( memcmp(fileHeader->magic, res_bake_magic, sizeof(res_bake_magic)) ||
+		 fileHeader->version != RES_BAKE_VERSION ||
+		 fileHeader->file_size != (uint32_t) fileSize ||
+		 fileHeader->table_count > MAX_RES_BAKE_TABLE ||
+		 sizeof(ResBakeFileHeader) + fileHeader->table_count * sizeof(ResBakeTableInfo) > (uint32_t) fileSize )
+	{
+		MSG("%s is out of date, it will be written again\n", RES_BAKE_FILE_NAME);
+		return 0;
+	}
+
+	//------- point the tables into the file -------//
+
+	ResBakeTableInfo* tableInfo = (ResBakeTableInfo*) (file_buf + sizeof(ResBakeFileHeader));
+
+	for( table_count=0 ; table_count<(int)fileHeader->table_count ; table_count++, tableInfo++ )
+	{
+		uint64_t dataEnd = (uint64_t) tableInfo->data_offset + (uint64_t) tableInfo->rec_size * tableInfo->rec_count;
+
+		if( dataEnd > (uint64_t) fileSize || tableInfo->name[RES_BAKE_NAME_LEN] )
+			return 0;
+
+		ResBakeTable* tablePtr = table_array+table_count;
+
+		tablePtr->info = *tableInfo;
+		tablePtr->data_ptr = file_buf + tableInfo->data_offset;
+		tablePtr->data_allocated = 0;
+	}
+
+	return 1;
+}
+//-------- End of function ResourceBake::read_file --------//
+
+
+//------- Begin of function ResourceBake::find_table -------//
+//
+// Whether a table has been baked from the same DBF in the set opened
+// by GameSet::open_set(). If so, the caller allocates the records and
+// calls copy_table(), without opening the DBF.
+//
+// <char*> tableName = name of the DBF
+// <int>   recSize   = sizeof() the record struct
+//
+// return : <long> >=0 - the no. of records of the table
+//                  -1 - the table must be parsed from the DBF and then add_table() called
+//
+long ResourceBake::find_table(const char* tableName, int recSize)
+{
+	if( !init_flag )
+		init();
+
+	ResBakeTable* tablePtr = get_table(tableName);
+	ResBakeSource src;
+
+	if( !tablePtr ||
+		 tablePtr->info.rec_size != (uint32_t) recSize ||
+		 !get_source(tableName, src) ||
+		 memcmp(&tablePtr->info.src, &src, sizeof(src)) )
+	{
+		miss_count++;
+		return -1;
+	}
+
+	hit_count++;
+	return tablePtr->info.rec_count;
+}
+//-------- End of function ResourceBake::find_table --------//
+
+
+//------- Begin of function ResourceBake::copy_table -------//
+//
+// Copy the records of a table found by find_table().
+//
+// <char*> tableName = name of the DBF
+// <void*> recArray  = the array of records to fill
+//
+void ResourceBake::copy_table(const char* tableName, void* recArray)
+{
+	ResBakeTable* tablePtr = get_table(tableName);
+
+	err_when( !tablePtr );
+
+	memcpy( recArray, tablePtr->data_ptr, (size_t) tablePtr->info.rec_size * tablePtr->info.rec_count );
+}
+//-------- End of function ResourceBake::copy_table --------//
+
+
+//------- Begin of function ResourceBake::add_table -------//
+//
+// Keep the parsed records of a table, replacing the older copy. They
+// are written to the file by save().
+//
+void ResourceBake::add_table(const char* tableName, Database* dbPtr, void* recArray, int recSize)
+{
+	if( !init_flag )
+		init();
+
+	err_when( strlen(tableName) > RES_BAKE_NAME_LEN );
+
+	ResBakeSource src;
+
+	if( !get_source(tableName, src) )		// the table could not be checked the next time
+		return;
+
+	ResBakeTable* tablePtr = get_table(tableName);
+
+	if( tablePtr )
+	{
+		free_table( tablePtr );
+	}
+	else
+	{
+		if( table_count == MAX_RES_BAKE_TABLE )
+			return;
+
+		tablePtr = table_array + table_count++;
+	}
+
+	long dataSize = (long) recSize * dbPtr->rec_count();
+
+	memset( &tablePtr->info, 0, sizeof(tablePtr->info) );
+	strncpy( tablePtr->info.name, tableName, RES_BAKE_NAME_LEN );
+
+	tablePtr->info.src       = src;
+	tablePtr->info.rec_size  = recSize;
+	tablePtr->info.rec_count = dbPtr->rec_count();
+
+	tablePtr->data_ptr = (char*) mem_add( MAX(dataSize, 1L) );
+	tablePtr->data_allocated = 1;
+
+	memcpy( tablePtr->data_ptr, recArray, dataSize );
+
+	changed_flag = 1;
+}
+//-------- End of function ResourceBake::add_table --------//
+
+
+//------- Begin of function ResourceBake::save -------//
+//
+// Write RESBAKE.DAT if tables have been added. Called after the
+// resources are loaded by Game::init().
+//
+void ResourceBake::save()
+{
+	if( !changed_flag )
+		return;
+
+	changed_flag = 0;
+
+	//------- lay out the tables -------//
+
+	ResBakeFileHeader fileHeader;
+	ResBakeTableInfo  tableInfoArray[MAX_RES_BAKE_TABLE];
+	uint32_t          fileSize = sizeof(ResBakeFileHeader) + table_count * sizeof(ResBakeTableInfo);
+	int               i;
+
+	for( i=0 ; i<table_count ; i++ )
+	{
+		fileSize = (fileSize + RES_BAKE_ALIGN - 1) & ~(uint32_t)(RES_BAKE_ALIGN - 1);
+
+		tableInfoArray[i] = table_array[i].info;
+		tableInfoArray[i].data_offset = fileSize;
+
+		fileSize += table_array[i].info.rec_size * table_array[i].info.rec_count;
+	}
+
+	memcpy( fileHeader.magic, res_bake_magic, sizeof(res_bake_magic) );
+	fileHeader.version     = RES_BAKE_VERSION;
+	fileHeader.table_count = table_count;
+	fileHeader.file_size   = fileSize;
+
+	//------- write the file -------//
+
+	FilePath full_path(sys.dir_config);
+	File file;
+
+	full_path += RES_BAKE_FILE_NAME;
+	if( full_path.error_flag )
+		return;
+
+	if( !file.file_create(full_path, 0, 1) )		// 0=don't handle error itself
+		return;
+
+	static const char padding[RES_BAKE_ALIGN] = { 0 };
+
+	uint32_t writeOffset = sizeof(ResBakeFileHeader) + table_count * sizeof(ResBakeTableInfo);
+
+	int rc = file.file_write( &fileHeader, sizeof(fileHeader) );
+
+	if( rc && table_count )
+		rc = file.file_write( tableInfoArray, table_count * sizeof(ResBakeTableInfo) );
+
+	for( i=0 ; rc && i<table_count ; i++ )
+	{
+		if( tableInfoArray[i].data_offset > writeOffset )
+			rc = file.file_write( (void*) padding, tableInfoArray[i].data_offset - writeOffset );
+
+		uint32_t dataSize = tableInfoArray[i].rec_size * tableInfoArray[i].rec_count;
+
+		if( rc && dataSize )
+			rc = file.file_write( table_array[i].data_ptr, dataSize );
+
+		writeOffset = tableInfoArray[i].data_offset + dataSize;
+	}
+
+	file.file_close();
+
+	if( !rc )
+		MSG("Failed writing %s\n", RES_BAKE_FILE_NAME);
+}
+//-------- End of function ResourceBake::save --------//
+
+
+//------- Begin of function ResourceBake::get_source -------//
+//
+// Get where the DBF is in the set opened by GameSet::open_set(). The
+// size and modification time of the set file are only read once.
+//
+// return : <int> 1 - src is set
+//                0 - no set is opened or the DBF is not in it
+//
+int ResourceBake::get_source(const char* tableName, ResBakeSource& src)
+{
+	if( !game_set.set_opened_flag )
+		return 0;
+
+	ResourceIdx* setRes = &game_set.set_res;
+	int indexId = setRes->get_index(tableName);
+
+	if( !indexId )
+		return 0;
+
+	if( strcmp(set_file_name, setRes->file_name) )
+	{
+		Directory setDir;
+
+		if( setDir.read(setRes->file_name)!=1 )
+			return 0;
+
+		strcpy( set_file_name, setRes->file_name );
+		set_mod_time  = setDir[1]->mod_time;
+		set_file_size = (uint32_t) setDir[1]->size;
+	}
+
+	memset( &src, 0, sizeof(src) );
+
+	src.mod_time  = set_mod_time;
+	src.file_size = set_file_size;
+	src.offset    = setRes->index_buf[indexId-1].pointer;
+	src.size      = setRes->index_buf[indexId].pointer - src.offset;		// the index has an extra entry after the last DBF
+
+	return 1;
+}
+//-------- End of function ResourceBake::get_source --------//
+
+
+//------- Begin of function ResourceBake::get_table -------//
+
+ResBakeTable* ResourceBake::get_table(const char* tableName)
+{
+	for( int i=0 ; i<table_count ; i++ )
+	{
+		if( strcmp(table_array[i].info.name, tableName)==0 )
+			return table_array+i;
+	}
+
+	return NULL;
+}
+//-------- End of function ResourceBake::get_table --------//
+
+
+//------- Begin of function ResourceBake::free_table -------//
+
+void ResourceBake::free_table(ResBakeTable* tablePtr)
+{
+	if( tablePtr->data_allocated && tablePtr->data_ptr )
+		mem_del( tablePtr->data_ptr );
+
+	tablePtr->data_ptr = NULL;
+	tablePtr->data_allocated = 0;
+}
+//-------- End of function ResourceBake::free_table --------//
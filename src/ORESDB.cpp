@@ -101,6 +101,29 @@ void ResourceDb::init_imported(const char* resName, int cacheWholeFile, int useC
 //----------- End of function ResourceDb::init_imported -------------//
 
 
+//---------- Begin of function ResourceDb::init_imported_buf ----------//
+//
+// Use a whole resource file that has already been read into memory,
+// as init_imported() with cacheWholeFile set.
+//
+// <char*> dataBuf     = the file contents allocated with mem_add(), freed by deinit()
+// <int>   dataBufSize = size of the file
+//
+void ResourceDb::init_imported_buf(char* dataBuf, int dataBufSize)
+{
+   deinit();
+
+   read_all = 1;
+   use_common_buf = 0;
+
+   data_buf = dataBuf;
+   data_buf_size = dataBufSize;
+
+   init_flag = true;
+}
+//----------- End of function ResourceDb::init_imported_buf -------------//
+
+
 
 //---------- Begin of function ResourceDb::read_imported ----------//
 //
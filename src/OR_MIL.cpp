@@ -27,6 +27,7 @@
 #include <OUNITRES.h>
 #include <OVBROWIF.h>
 #include <ONATION.h>
+#include <ONATVIEW.h>
 #include <OUNIT.h>
 #include <OINFO.h>
 #include "gettext.h"
@@ -155,10 +156,11 @@ void Info::detect_military()
 
 		if( browse_troop.double_click )
 		{
-			Unit* unitPtr = unit_array[ troop_filter(browse_troop_recno) ];
+			int	unitRecno = troop_filter(browse_troop_recno);
 			short xLoc, yLoc;
 
-			if( unitPtr->get_cur_loc(xLoc, yLoc) )
+			if( !unit_array.is_deleted(unitRecno) &&
+				 unit_array[unitRecno]->get_cur_loc(xLoc, yLoc) )
 			{
 				world.go_loc(xLoc, yLoc, 1);
 			}
@@ -290,36 +292,28 @@ static void disp_unit_total()
 // This function has dual purpose :
 //
 // 1. when <int> recNo is not given :
-//    - return the total no. of firms of this nation
+//    - rebuild info.report_array from the nation's general list and
+//      return the total no. of generals of this nation
 //
 // 2. when <int> recNo is given :
-//    - return the firm recno in firm_array of the given recno.
+//    - return the unit recno in unit_array of the given recno.
 //
 static int troop_filter(int recNo)
 {
-	int   i, unitCount=0, totalUnit=unit_array.size();
-	Unit* unitPtr;
+	if( recNo )
+		return info.get_report_data(recNo);
 
-	for( i=1 ; i<=totalUnit ; i++ )
-	{
-		if( unit_array.is_deleted(i) )
-			continue;
+	std::vector<short>& generalList = nation_view_array[info.viewing_nation_recno]->general_list;
 
-		unitPtr = unit_array[i];
+	info.report_array.zap();
 
-		if( unitPtr->nation_recno == info.viewing_nation_recno &&
-			 (unitPtr->rank_id==RANK_GENERAL || unitPtr->rank_id==RANK_KING) )
-		{
-			unitCount++;
-		}
-
-		if( recNo && unitCount==recNo )
-			return i;
+	for( int i=0 ; i<(int)generalList.size() ; i++ )
+	{
+		if( !unit_array.is_deleted(generalList[i]) )
+			info.report_array.linkin(&generalList[i]);
 	}
 
-	err_when( recNo );   // the recNo is not found, it is out of range
-
-	return unitCount;
+	return info.report_array.size();
 }
 //----------- End of static function troop_filter -----------//
 
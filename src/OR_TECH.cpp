@@ -28,6 +28,7 @@
 #include <OTECHRES.h>
 #include <ORACERES.h>
 #include <ONATION.h>
+#include <ONATVIEW.h>
 #include <OU_GOD.h>
 #include <OINFO.h>
 #include "gettext.h"
@@ -65,6 +66,7 @@ static void put_god_rec(int recNo, int x, int y, int refreshFlag);
 static void disp_owned_scroll();
 static void disp_scroll(int x, int y, int raceId);
 static void put_heading(char justify, int x1, int y1, int x2, int y2, const char *textPtr);
+static int  sort_recno( const void *a, const void *b );
 
 #define J_L Font::LEFT_JUSTIFY
 #define J_C Font::CENTER_JUSTIFY
@@ -170,9 +172,10 @@ void Info::detect_tech()
 
 		if( browse_god.double_click )
 		{
-			Unit* unitPtr = unit_array[ god_filter(browse_god.recno()) ];
+			int unitRecno = god_filter(browse_god.recno());
 
-			world.go_loc( unitPtr->next_x_loc(), unitPtr->next_y_loc(), 1 );
+			if( !unit_array.is_deleted(unitRecno) )
+				world.go_loc( unit_array[unitRecno]->next_x_loc(), unit_array[unitRecno]->next_y_loc(), 1 );
 		}
 	}
 }
@@ -220,40 +223,53 @@ static int tech_filter(int recNo)
 // This function has dual purpose :
 //
 // 1. when <int> recNo is not given :
-//    - return the total no. of firms of this nation
+//    - rebuild info.report_array from the nation's god units and
+//      return the total no. of gods of this nation
 //
 // 2. when <int> recNo is given :
-//    - return the firm recno in firm_array of the given recno.
+//    - return the unit recno in unit_array of the given recno.
 //
 static int god_filter(int recNo)
 {
-	int 	godCount=0, totalUnit=unit_array.size();
-	Unit* unitPtr;
+	if( recNo )
+		return info.get_report_data(recNo);
+
+	NationView* nationView = nation_view_array[info.viewing_nation_recno];
 
-	for( int i=1 ; i<=totalUnit ; i++ )
+	info.report_array.zap();
+
+	for( int unitId=1 ; unitId<=MAX_UNIT_TYPE ; unitId++ )
 	{
-		if( unit_array.is_deleted(i) )
+		if( unit_res[unitId]->unit_class != UNIT_CLASS_GOD )
 			continue;
 
-		unitPtr = unit_array[i];
+		std::vector<short>& godList = nationView->units(unitId);
 
-		if( unitPtr->nation_recno == info.viewing_nation_recno &&
-			 unit_res[ unitPtr->unit_id ]->unit_class == UNIT_CLASS_GOD )
+		for( int i=0 ; i<(int)godList.size() ; i++ )
 		{
-			godCount++;
+			if( !unit_array.is_deleted(godList[i]) )
+				info.report_array.linkin(&godList[i]);
 		}
-
-		if( recNo && godCount==recNo )
-			return i;
 	}
 
-	err_when( recNo );   // the recNo is not found, it is out of range
+	//--- the lists are by god type, list them in recno order as before ---//
 
-	return godCount;
+	info.report_array.quick_sort(sort_recno);
+
+	return info.report_array.size();
 }
 //----------- End of static function god_filter -----------//
 
 
+//------ Begin of function sort_recno ------//
+//
+static int sort_recno( const void *a, const void *b )
+{
+	return *((short*)a) - *((short*)b);
+}
+//------- End of function sort_recno ------//
+
+
 //-------- Begin of static function put_tech_rec --------//
 //
 static void put_tech_rec(int recNo, int x, int y, int refreshFlag)
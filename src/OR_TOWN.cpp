@@ -28,6 +28,7 @@
 #include <ORACERES.h>
 #include <OWORLD.h>
 #include <ONATION.h>
+#include <ONATVIEW.h>
 #include <OINFO.h>
 #include "gettext.h"
 
@@ -147,9 +148,10 @@ void Info::detect_town()
 
 		if( browse_town.double_click )
 		{
-			Town* townPtr = town_array[ town_filter(browse_town_recno) ];
+			int townRecno = town_filter(browse_town_recno);
 
-			world.go_loc(townPtr->center_x, townPtr->center_y, 1);
+			if( !town_array.is_deleted(townRecno) )
+				world.go_loc(town_array[townRecno]->center_x, town_array[townRecno]->center_y, 1);
 		}
 	}
 
@@ -255,22 +257,22 @@ static void calc_firm_total()
 
 	int   thisIncome;
 	Firm* firmPtr;
+	NationView* nationView = nation_view_array[info.viewing_nation_recno];
 
 	int i;
-	for( i=firm_array.size() ; i>0 ; i-- )
+	for( i=1 ; i<=MAX_FIRM_TYPE ; i++ )
 	{
-		if( firm_array.is_deleted(i) )
-			continue;
+		std::vector<short>& firmList = nationView->firms(i);
 
-		firmPtr = firm_array[i];
-
-		if( firmPtr->nation_recno == info.viewing_nation_recno )
+		for( int j=(int)firmList.size()-1 ; j>=0 ; j-- )
 		{
+			firmPtr = firm_array[firmList[j]];
+
 			thisIncome = (int) firmPtr->income_365days();
 
 			if( thisIncome > 0 )
 			{
-				firm_income_array[firmPtr->firm_id-1] += thisIncome;
+				firm_income_array[i-1] += thisIncome;
 				total_firm_income += thisIncome;
 			}
 		}
@@ -301,34 +303,28 @@ static void calc_firm_total()
 // This function has dual purpose :
 //
 // 1. when <int> recNo is not given :
-//    - return the total no. of firms of this nation
+//    - rebuild info.report_array from the nation's town list and
+//      return the total no. of towns of this nation
 //
 // 2. when <int> recNo is given :
-//    - return the firm recno in firm_array of the given recno.
+//    - return the town recno in town_array of the given recno.
 //
 static int town_filter(int recNo)
 {
-	int   totalTown = town_array.size();
-	int   townCount=0;
-	Town* townPtr;
+	if( recNo )
+		return info.get_report_data(recNo);
 
-	for( int townRecno=1 ; townRecno<=totalTown ; townRecno++ )
-	{
-		if( town_array.is_deleted(townRecno) )
-			continue;
+	std::vector<short>& townList = nation_view_array[info.viewing_nation_recno]->town_list;
 
-		townPtr = town_array[townRecno];
-
-		if( townPtr->nation_recno==info.viewing_nation_recno )
-			townCount++;
+	info.report_array.zap();
 
-		if( recNo && townCount==recNo )
-			return townRecno;
+	for( int i=0 ; i<(int)townList.size() ; i++ )
+	{
+		if( !town_array.is_deleted(townList[i]) )
+			info.report_array.linkin(&townList[i]);
 	}
 
-	err_when( recNo );   // the recNo is not found, it is out of range
-
-	return townCount;
+	return info.report_array.size();
 }
 //----------- End of static function town_filter -----------//
 
@@ -30,6 +30,7 @@
 #include <OFIRM.h>
 #include <OWORLD.h>
 #include <ONATION.h>
+#include <ONATVIEW.h>
 #include <OU_CARA.h>
 #include <OU_MARI.h>
 #include <OINFO.h>
@@ -113,6 +114,7 @@ static void put_stop_info(int x, int y, TradeStop* tradeStop);
 
 static int  sort_firm( const void *a, const void *b );
 static int  sort_unit( const void *a, const void *b );
+static int  sort_recno( const void *a, const void *b );
 
 static int  can_copy_caravan();
 static int  can_copy_ship();
@@ -505,26 +507,21 @@ static void disp_total()
 //
 static void create_caravan_list()
 {
-	int   totalUnit = unit_array.size();
-	Unit* unitPtr;
+	std::vector<short>& caravanList = nation_view_array[info.viewing_nation_recno]->units(UNIT_CARAVAN);
 
 	info.report_array.zap();
 	idle_caravans = 0;
 
-	for( short unitRecno=1 ; unitRecno<=totalUnit ; unitRecno++ )
+	for( int i=0 ; i<(int)caravanList.size() ; i++ )
 	{
+		short unitRecno = caravanList[i];
+
 		if( unit_array.is_deleted(unitRecno) )
 			continue;
 
-		unitPtr = unit_array[unitRecno];
-
-		if( unitPtr->nation_recno == info.viewing_nation_recno &&
-			 unitPtr->unit_id == UNIT_CARAVAN )
-		{
-			info.report_array.linkin(&unitRecno);
-			if( is_caravan_route_idle((UnitCaravan*)unitPtr) )
-				idle_caravans++;
-		}
+		info.report_array.linkin(&unitRecno);
+		if( is_caravan_route_idle((UnitCaravan*)unit_array[unitRecno]) )
+			idle_caravans++;
 	}
 
 	info.report_array.quick_sort(sort_unit);
@@ -536,7 +533,6 @@ static void create_caravan_list()
 //
 static void create_firm_list()
 {
-	int   totalFirm = firm_array.size();
 	Firm* firmPtr;
 
 	info.report_array2.zap();
@@ -589,77 +585,96 @@ static void create_firm_list()
 		selected_unit_recno = 0;
 	}
 
-	for( short firmRecno=1 ; firmRecno<=totalFirm ; firmRecno++ )
+	for( int nationRecno=1 ; nationRecno<=nation_array.size() ; nationRecno++ )
 	{
-		if( firm_array.is_deleted(firmRecno) )
+		if( nation_array.is_deleted(nationRecno) )
 			continue;
 
-		firmPtr = firm_array[firmRecno];
+		NationView* nationView = nation_view_array[nationRecno];
 
-		if( !viewHarbor && firmPtr->firm_id == FIRM_MARKET )
+		for( int firmId=1 ; firmId<=MAX_FIRM_TYPE ; firmId++ )
 		{
-			if( unitRecno && firmPtr->region_id != regionId )
+			if( firmId != FIRM_MARKET && nationRecno != nation_array.player_recno )		// only markets are listed for other nations
 				continue;
 
-			if( mode_firm != BROWSE_MARKET && mode_firm != BROWSE_ANY )
-				continue;
+			std::vector<short>& firmList = nationView->firms(firmId);
 
-			if( !nation_array[firmPtr->nation_recno]->get_relation(nation_array.player_recno)->trade_treaty )
-				continue;
-		}
+			for( int i=0 ; i<(int)firmList.size() ; i++ )
+			{
+				short firmRecno = firmList[i];
 
-		else if( !viewHarbor && firmPtr->firm_id == FIRM_FACTORY )
-		{
-			if( unitRecno && firmPtr->region_id != regionId )
-				continue;
+				firmPtr = firm_array[firmRecno];
 
-			if( firmPtr->nation_recno != nation_array.player_recno )
-				continue;
+				if( !viewHarbor && firmPtr->firm_id == FIRM_MARKET )
+				{
+					if( unitRecno && firmPtr->region_id != regionId )
+						continue;
 
-			if( mode_firm != BROWSE_FACTORY && mode_firm != BROWSE_ANY )
-				continue;
-		}
+					if( mode_firm != BROWSE_MARKET && mode_firm != BROWSE_ANY )
+						continue;
 
-		else if( !viewHarbor && firmPtr->firm_id == FIRM_MINE )
-		{
-			if( unitRecno && firmPtr->region_id != regionId )
-				continue;
+					if( !nation_array[firmPtr->nation_recno]->get_relation(nation_array.player_recno)->trade_treaty )
+						continue;
+				}
 
-			if( firmPtr->nation_recno != nation_array.player_recno )
-				continue;
+				else if( !viewHarbor && firmPtr->firm_id == FIRM_FACTORY )
+				{
+					if( unitRecno && firmPtr->region_id != regionId )
+						continue;
 
-			if( mode_firm != BROWSE_MINE && mode_firm != BROWSE_ANY )
-				continue;
-		}
+					if( firmPtr->nation_recno != nation_array.player_recno )
+						continue;
 
-		else if( viewHarbor && firmPtr->firm_id == FIRM_HARBOR )
-		{
-			if( firmPtr->nation_recno != nation_array.player_recno )
-				continue;
+					if( mode_firm != BROWSE_FACTORY && mode_firm != BROWSE_ANY )
+						continue;
+				}
 
-			FirmHarbor* firmHarbor = firmPtr->cast_to_FirmHarbor();
+				else if( !viewHarbor && firmPtr->firm_id == FIRM_MINE )
+				{
+					if( unitRecno && firmPtr->region_id != regionId )
+						continue;
 
-			if( unitRecno && firmHarbor->sea_region_id != regionId )
-				continue;
+					if( firmPtr->nation_recno != nation_array.player_recno )
+						continue;
 
-			if( mode_firm == BROWSE_MARKET && !firmHarbor->linked_market_num )
-				continue;
-			else if( mode_firm == BROWSE_FACTORY && !firmHarbor->linked_factory_num )
-				continue;
-			else if( mode_firm == BROWSE_MINE && !firmHarbor->linked_mine_num )
-				continue;
-		}
+					if( mode_firm != BROWSE_MINE && mode_firm != BROWSE_ANY )
+						continue;
+				}
 
-		else
-		{
-			continue;
-		}
+				else if( viewHarbor && firmPtr->firm_id == FIRM_HARBOR )
+				{
+					if( firmPtr->nation_recno != nation_array.player_recno )
+						continue;
+
+					FirmHarbor* firmHarbor = firmPtr->cast_to_FirmHarbor();
+
+					if( unitRecno && firmHarbor->sea_region_id != regionId )
+						continue;
 
-		info.report_array2.linkin(&firmRecno);
-		if( is_firm_idle((Firm*)firmPtr) )
-			idle_firms++;
+					if( mode_firm == BROWSE_MARKET && !firmHarbor->linked_market_num )
+						continue;
+					else if( mode_firm == BROWSE_FACTORY && !firmHarbor->linked_factory_num )
+						continue;
+					else if( mode_firm == BROWSE_MINE && !firmHarbor->linked_mine_num )
+						continue;
+				}
+
+				else
+				{
+					continue;
+				}
+
+				info.report_array2.linkin(&firmRecno);
+				if( is_firm_idle((Firm*)firmPtr) )
+					idle_firms++;
+			}
+		}
 	}
 
+	//--- the lists are by nation and firm type, put them in recno order ---//
+	//--- first, so sort_firm starts from the same order as before ---//
+
+	info.report_array2.quick_sort(sort_recno);
 	info.report_array2.quick_sort(sort_firm);
 }
 //----------- End of static function create_firm_list -----------//
@@ -669,25 +684,27 @@ static void create_firm_list()
 //
 static void create_ship_list()
 {
-	int   totalUnit = unit_array.size();
-	Unit* unitPtr;
+	NationView* nationView = nation_view_array[info.viewing_nation_recno];
 
 	info.report_array.zap();
 
-	for( short unitRecno=1 ; unitRecno<=totalUnit ; unitRecno++ )
+	for( int unitId=1 ; unitId<=MAX_UNIT_TYPE ; unitId++ )
 	{
-		if( unit_array.is_deleted(unitRecno) )
+		if( unit_res[unitId]->carry_goods_capacity <= 0 )
 			continue;
 
-		unitPtr = unit_array[unitRecno];
+		std::vector<short>& shipList = nationView->units(unitId);
 
-		if( unitPtr->nation_recno == info.viewing_nation_recno &&
-			 unit_res[unitPtr->unit_id]->carry_goods_capacity > 0 )
+		for( int i=0 ; i<(int)shipList.size() ; i++ )
 		{
-			info.report_array.linkin(&unitRecno);
+			if( !unit_array.is_deleted(shipList[i]) )
+				info.report_array.linkin(&shipList[i]);
 		}
 	}
 
+	//--- the lists are by unit type, put them in recno order first ---//
+
+	info.report_array.quick_sort(sort_recno);
 	info.report_array.quick_sort(sort_unit);
 }
 //----------- End of static function create_ship_list -----------//
@@ -1189,6 +1206,15 @@ static int sort_unit( const void *a, const void *b )
 //------- End of function sort_unit ------//
 
 
+//------ Begin of function sort_recno ------//
+//
+static int sort_recno( const void *a, const void *b )
+{
+	return *((short*)a) - *((short*)b);
+}
+//------- End of function sort_recno ------//
+
+
 //------ Begin of function can_copy_caravan ------//
 //
 static int can_copy_caravan()
@@ -23,6 +23,7 @@
 
 #include <OGAMESET.h>
 #include <OSFRMRES.h>
+#include <ORESBAKE.h>
 
 //-------- define file name -----------//
 
@@ -62,18 +63,32 @@ void SpriteFrameRes::deinit()
 
 void SpriteFrameRes::load_info()
 {
-	Database   		*dbSpriteFrame = game_set.open_db(SPRITE_FRAME_DB);
 	SpriteFrameRec *frameRec;
 	SpriteFrame 	*spriteFrame;
 	int		  		i;
 
+	//------- copy the baked records if they are up to date -------//
+
+	long bakedCount = res_bake.find_table(SPRITE_FRAME_DB, sizeof(SpriteFrame));
+
+	if( bakedCount >= 0 )
+	{
+		sprite_frame_count = bakedCount;
+		sprite_frame_array = new SpriteFrame[sprite_frame_count];
+
+		res_bake.copy_table(SPRITE_FRAME_DB, sprite_frame_array);
+		return;
+	}
+
+	//--------- read in frame information ---------//
+
+	Database *dbSpriteFrame = game_set.open_db(SPRITE_FRAME_DB);
+
 	sprite_frame_count = dbSpriteFrame->rec_count();
 	sprite_frame_array = new SpriteFrame[sprite_frame_count];
 
 	memset( sprite_frame_array, 0, sizeof(SpriteFrame)*sprite_frame_count );
 
-	//--------- read in frame information ---------//
-
 	for( i=0 ; i<dbSpriteFrame->rec_count() ; i++ )
 	{
 		frameRec  = (SpriteFrameRec*) dbSpriteFrame->read(i+1);
@@ -87,6 +102,8 @@ void SpriteFrameRes::load_info()
 
 		memcpy( &spriteFrame->bitmap_offset, frameRec->bitmap_offset, sizeof(uint32_t) );
 	}
+
+	res_bake.add_table(SPRITE_FRAME_DB, dbSpriteFrame, sprite_frame_array, sizeof(SpriteFrame));
 }
 //-------- End of function SpriteFrameRes::load_info ---------//
 
@@ -202,7 +202,8 @@ static void sys_yield()
 //------- Begin of static function can_move_to ------//
 static int can_move_to(int xLoc, int yLoc)
 {
-	Location	*locPtr = world_loc_matrix+yLoc*MAX_WORLD_X_LOC+xLoc;
+	int		locOffset = yLoc*MAX_WORLD_X_LOC+xLoc;
+	Location	*locPtr = world_loc_matrix+locOffset;		// only read when there is a unit or for the power and region checks
 	Unit		*unitPtr;
 	short		recno;
 	char		powerNationRecno;
@@ -219,13 +220,14 @@ static int can_move_to(int xLoc, int yLoc)
 			if(search_mode<SEARCH_MODE_TO_FIRM)  //------ be careful for the checking for search_mode>=SEARCH_MODE_TO_FIRM
 			{
 				//------------------------------------------------------------------------//
-				if(!locPtr->walkable())
+				if(!(world.pass_map.get(locOffset) & PASS_LAND))
 					return 0;
-				
-				recno = locPtr->cargo_recno;
-				if(!recno)
+
+				if(!(world.occupy_map.get(locOffset) & OCCUPY_GROUND))
 					return 1;
 
+				recno = locPtr->cargo_recno;
+
 				switch(search_mode)
 				{
 					case SEARCH_MODE_IN_A_GROUP:	// group move
@@ -300,13 +302,14 @@ static int can_move_to(int xLoc, int yLoc)
 		case UNIT_SEA:
 			if(search_mode<SEARCH_MODE_TO_FIRM) //--------- be careful for the search_mode>=SEARCH_MODE_TO_FIRM
 			{
-				if(!locPtr->sailable())
+				if(!(world.pass_map.get(locOffset) & PASS_SEA))
 					return 0;
 
-				recno = locPtr->cargo_recno;
-				if(!recno)
+				if(!(world.occupy_map.get(locOffset) & OCCUPY_GROUND))
 					return 1;
 
+				recno = locPtr->cargo_recno;
+
 				switch(search_mode)
 				{
 					case SEARCH_MODE_IN_A_GROUP:	// group move
@@ -384,9 +387,10 @@ static int can_move_to(int xLoc, int yLoc)
 			break;
 
 		case UNIT_AIR:
-			recno = locPtr->air_cargo_recno;
-			if(!recno)
+			if(!(world.occupy_map.get(locOffset) & OCCUPY_AIR))
 				return 1;
+
+			recno = locPtr->air_cargo_recno;
 			switch(search_mode)
 			{
 				case SEARCH_MODE_IN_A_GROUP:
@@ -566,6 +570,24 @@ void SeekPath::set_sub_mode(char subMode)
 //--------- End of function SeekPath::set_sub_mode ---------//
 
 
+//-------- Begin of function SeekPath::get_sub_mode ---------//
+char SeekPath::get_sub_mode()
+{
+	return search_sub_mode;
+}
+//--------- End of function SeekPath::get_sub_mode ---------//
+
+
+//-------- Begin of function SeekPath::get_nation_passable ---------//
+// return the array set by set_nation_passable(), MAX_NATION in size
+//
+char* SeekPath::get_nation_passable()
+{
+	return nation_passable+1;
+}
+//--------- End of function SeekPath::get_nation_passable ---------//
+
+
 //-------- Begin of function SeekPath::add_result_node ---------//
 inline void SeekPath::add_result_node(int x, int y, ResultNode** curPtr, ResultNode** prePtr, int& count)
 {
@@ -0,0 +1,331 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OSPATHC.CPP
+//Description : Object SeekPathCache
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ALL.h>
+#include <OFONT.h>
+#include <OWORLD.h>
+#include <OSPATH.h>
+#include <OSPATHC.h>
+#include <dbglog.h>
+
+DBGLOG_DEFAULT_CHANNEL(SeekPathCache);
+
+//------- Begin of function SeekPathCache::SeekPathCache -------//
+
+SeekPathCache::SeekPathCache()
+{
+	memset( entry_array, 0, sizeof(entry_array) );
+
+	cell_stamp_array = NULL;
+	cell_width = cell_height = 0;
+	change_stamp = 0;
+
+	hit_count = miss_count = expire_count = 0;
+}
+//-------- End of function SeekPathCache::SeekPathCache --------//
+
+
+//------- Begin of function SeekPathCache::init -------//
+//
+// Called when the map is assigned, for a new or loaded game.
+//
+void SeekPathCache::init(int maxXLoc, int maxYLoc)
+{
+	clear();
+
+	cell_width  = (maxXLoc + SEEK_PATH_CACHE_CELL - 1) / SEEK_PATH_CACHE_CELL;
+	cell_height = (maxYLoc + SEEK_PATH_CACHE_CELL - 1) / SEEK_PATH_CACHE_CELL;
+
+	cell_stamp_array = (uint32_t*) mem_resize( cell_stamp_array, cell_width * cell_height * sizeof(uint32_t) );
+	memset( cell_stamp_array, 0, cell_width * cell_height * sizeof(uint32_t) );
+
+	change_stamp = 0;
+	hit_count = miss_count = expire_count = 0;
+}
+//-------- End of function SeekPathCache::init --------//
+
+
+//------- Begin of function SeekPathCache::deinit -------//
+
+void SeekPathCache::deinit()
+{
+	if( hit_count || miss_count )
+	{
+		MSG("Path cache: %lu hits, %lu misses, %lu paths out of date\n",
+			hit_count, miss_count, expire_count);
+	}
+
+	clear();
+
+	if( cell_stamp_array )
+	{
+		mem_del( cell_stamp_array );
+		cell_stamp_array = NULL;
+	}
+
+	cell_width = cell_height = 0;
+	hit_count = miss_count = expire_count = 0;
+}
+//-------- End of function SeekPathCache::deinit --------//
+
+
+//------- Begin of function SeekPathCache::clear -------//
+//
+// Drop all paths. Also called before the game is sent to other
+// players, as they start with an empty cache.
+//
+void SeekPathCache::clear()
+{
+	for( int i=0 ; i<SEEK_PATH_CACHE_SIZE ; i++ )
+		free_entry( entry_array+i );
+}
+//-------- End of function SeekPathCache::clear --------//
+
+
+//------- Begin of function SeekPathCache::loc_changed -------//
+//
+// Called when a location has become passable or impassable. The cells
+// of the adjacent locations are marked as well, as paths going next
+// to the location may now cut its corner or be blocked by it.
+//
+void SeekPathCache::loc_changed(int xLoc, int yLoc)
+{
+	if( !cell_stamp_array )
+		return;
+
+	change_stamp++;
+
+	int cellX1 = MAX(xLoc-1, 0) / SEEK_PATH_CACHE_CELL;
+	int cellY1 = MAX(yLoc-1, 0) / SEEK_PATH_CACHE_CELL;
+	int cellX2 = MIN((xLoc+1) / SEEK_PATH_CACHE_CELL, cell_width-1);
+	int cellY2 = MIN((yLoc+1) / SEEK_PATH_CACHE_CELL, cell_height-1);
+
+	for( int cellY=cellY1 ; cellY<=cellY2 ; cellY++ )
+	{
+		for( int cellX=cellX1 ; cellX<=cellX2 ; cellX++ )
+			cell_stamp_array[cellY*cell_width+cellX] = change_stamp;
+	}
+}
+//-------- End of function SeekPathCache::loc_changed --------//
+
+
+//------- Begin of function SeekPathCache::can_cache -------//
+//
+// Only searches for going to a location, a firm or a town are cached.
+// Air units fly straight and are only blocked by other units.
+//
+int SeekPathCache::can_cache(char mobileType, short searchMode, short numOfPath)
+{
+	if( mobileType==UNIT_AIR || numOfPath!=1 )		// numOfPath spreads out the destinations of group assignments
+		return 0;
+
+	switch( searchMode )
+	{
+		case SEARCH_MODE_IN_A_GROUP:
+		case SEARCH_MODE_A_UNIT_IN_GROUP:
+		case SEARCH_MODE_TO_FIRM:
+		case SEARCH_MODE_TO_TOWN:
+			return 1;
+	}
+
+	return 0;
+}
+//-------- End of function SeekPathCache::can_cache --------//
+
+
+//------- Begin of function SeekPathCache::get_path -------//
+//
+// Return a copy of the cached path, the same as SeekPath::get_result(),
+// or NULL if it is not cached. seek_path's sub mode must be set as for
+// seeking the path.
+//
+ResultNode* SeekPathCache::get_path(int startXLoc, int startYLoc, int destXLoc, int destYLoc, char mobileType,
+												short searchMode, short miscNo, char nationRecno, int& nodeCount, short& pathDist)
+{
+	SeekPathCacheEntry* entryPtr = get_entry(startXLoc, startYLoc, destXLoc, destYLoc, mobileType, searchMode, miscNo);
+
+	if( seek_path.get_sub_mode()!=SEARCH_SUB_MODE_PASSABLE )
+		nationRecno = 0;
+
+	if( !entryPtr->node_array ||
+		 entryPtr->start_x_loc!=startXLoc || entryPtr->start_y_loc!=startYLoc ||
+		 entryPtr->dest_x_loc!=destXLoc || entryPtr->dest_y_loc!=destYLoc ||
+		 entryPtr->mobile_type!=mobileType || entryPtr->search_mode!=searchMode ||
+		 entryPtr->misc_no!=miscNo || entryPtr->nation_recno!=nationRecno ||
+		 (nationRecno && memcmp(entryPtr->nation_passable, seek_path.get_nation_passable(), MAX_NATION)) )
+	{
+		miss_count++;
+		return NULL;
+	}
+
+	if( !is_path_valid(entryPtr) ||
+		 (nationRecno && entryPtr->power_change_count!=world.power_change_count) )		// the path may now go through hostile territory, or around territory opened up
+	{
+		free_entry(entryPtr);
+		expire_count++;
+		miss_count++;
+		return NULL;
+	}
+
+	hit_count++;
+
+	ResultNode* nodeArray = (ResultNode*) mem_add( sizeof(ResultNode) * entryPtr->node_count );
+	memcpy( nodeArray, entryPtr->node_array, sizeof(ResultNode) * entryPtr->node_count );
+
+	nodeCount = entryPtr->node_count;
+	pathDist  = entryPtr->path_dist;
+
+	return nodeArray;
+}
+//-------- End of function SeekPathCache::get_path --------//
+
+
+//------- Begin of function SeekPathCache::add_path -------//
+//
+// Keep a copy of a path that has been found all the way to the
+// destination, replacing the path kept in its entry.
+//
+void SeekPathCache::add_path(int startXLoc, int startYLoc, int destXLoc, int destYLoc, char mobileType,
+									  short searchMode, short miscNo, char nationRecno, ResultNode* nodeArray, int nodeCount, short pathDist)
+{
+	if( !cell_stamp_array || !nodeArray || nodeCount<2 )
+		return;
+
+	SeekPathCacheEntry* entryPtr = get_entry(startXLoc, startYLoc, destXLoc, destYLoc, mobileType, searchMode, miscNo);
+
+	if( seek_path.get_sub_mode()!=SEARCH_SUB_MODE_PASSABLE )
+		nationRecno = 0;
+
+	entryPtr->node_array = (ResultNode*) mem_resize( entryPtr->node_array, sizeof(ResultNode) * nodeCount );
+	memcpy( entryPtr->node_array, nodeArray, sizeof(ResultNode) * nodeCount );
+
+	entryPtr->node_count   = nodeCount;
+	entryPtr->path_dist    = pathDist;
+	entryPtr->start_x_loc  = startXLoc;
+	entryPtr->start_y_loc  = startYLoc;
+	entryPtr->dest_x_loc   = destXLoc;
+	entryPtr->dest_y_loc   = destYLoc;
+	entryPtr->mobile_type  = mobileType;
+	entryPtr->search_mode  = (char) searchMode;
+	entryPtr->misc_no      = miscNo;
+	entryPtr->nation_recno = nationRecno;
+	entryPtr->change_stamp = change_stamp;
+	entryPtr->power_change_count = world.power_change_count;
+
+	if( nationRecno )
+		memcpy( entryPtr->nation_passable, seek_path.get_nation_passable(), MAX_NATION );
+	else
+		memset( entryPtr->nation_passable, 0, MAX_NATION );
+}
+//-------- End of function SeekPathCache::add_path --------//
+
+
+//------- Begin of function SeekPathCache::get_entry -------//
+//
+// Return the entry the search is kept in, whether or not it is the
+// same search.
+//
+SeekPathCacheEntry* SeekPathCache::get_entry(int startXLoc, int startYLoc, int destXLoc, int destYLoc, char mobileType, short searchMode, short miscNo)
+{
+	uint32_t hashValue = (uint32_t) (startYLoc*MAX_WORLD_X_LOC + startXLoc) * 2654435761u;
+
+	hashValue ^= (uint32_t) (destYLoc*MAX_WORLD_X_LOC + destXLoc) * 40503u;
+	hashValue ^= (uint32_t) (searchMode << 8 | mobileType) * 97u + miscNo;
+
+	return entry_array + ((hashValue ^ (hashValue >> 16)) & (SEEK_PATH_CACHE_SIZE-1));
+}
+//-------- End of function SeekPathCache::get_entry --------//
+
+
+//------- Begin of function SeekPathCache::is_path_valid -------//
+//
+// Whether none of the cells the path goes through has changed since
+// the path was found.
+//
+int SeekPathCache::is_path_valid(SeekPathCacheEntry* entryPtr)
+{
+	ResultNode* nodePtr = entryPtr->node_array;
+	int lastCellId = -1;
+
+	for( int i=1 ; i<entryPtr->node_count ; i++, nodePtr++ )
+	{
+		int xLoc = nodePtr[0].node_x, yLoc = nodePtr[0].node_y;
+		int stepX = (nodePtr[1].node_x > xLoc) - (nodePtr[1].node_x < xLoc);
+		int stepY = (nodePtr[1].node_y > yLoc) - (nodePtr[1].node_y < yLoc);
+
+		for( ;; xLoc+=stepX, yLoc+=stepY )
+		{
+			int cellId = (yLoc / SEEK_PATH_CACHE_CELL) * cell_width + xLoc / SEEK_PATH_CACHE_CELL;
+
+			if( cellId != lastCellId )
+			{
+				if( cell_stamp_array[cellId] > entryPtr->change_stamp )
+					return 0;
+
+				lastCellId = cellId;
+			}
+
+			if( xLoc==nodePtr[1].node_x && yLoc==nodePtr[1].node_y )
+				break;
+		}
+	}
+
+	return 1;
+}
+//-------- End of function SeekPathCache::is_path_valid --------//
+
+
+//------- Begin of function SeekPathCache::free_entry -------//
+
+void SeekPathCache::free_entry(SeekPathCacheEntry* entryPtr)
+{
+	if( entryPtr->node_array )
+	{
+		mem_del( entryPtr->node_array );
+		entryPtr->node_array = NULL;
+	}
+
+	entryPtr->node_count = 0;
+}
+//-------- End of function SeekPathCache::free_entry --------//
+
+
+//--------- Begin of function SeekPathCache::draw_profile ---------//
+//
+// Shown with the other profile information when config.show_ai_info
+// is on.
+//
+void SeekPathCache::draw_profile()
+{
+	char str[100];
+	unsigned long searchCount = hit_count + miss_count;
+
+	snprintf( str, sizeof(str), "Path cache: %lu hits, %lu misses, %lu out of date (%lu%% hits)",
+		hit_count, miss_count, expire_count, searchCount ? hit_count*100/searchCount : 0 );
+
+	font_news.put( ZOOM_X1+300, ZOOM_Y1+250, str );
+}
+//----------- End of function SeekPathCache::draw_profile -----------//
@@ -48,8 +48,9 @@ int SeekPathReuse::can_walk(int xLoc, int yLoc)
 	if(xLoc>=MAX_WORLD_X_LOC || yLoc>=MAX_WORLD_Y_LOC)
 		return 0;
 
-	Location *locPtr = world.get_loc(xLoc, yLoc);
-	short	recno = (mobile_type!=UNIT_AIR) ? locPtr->cargo_recno : locPtr->air_cargo_recno;
+	int		locOffset = yLoc*MAX_WORLD_X_LOC+xLoc;
+	Location *locPtr = world.loc_matrix+locOffset;		// only read when there is a unit or for the power check
+	short	recno;
 	Unit *unitPtr;
 	uint8_t	unitCurAction;
 
@@ -62,12 +63,14 @@ int SeekPathReuse::can_walk(int xLoc, int yLoc)
 				!reuse_nation_passable[locPtr->power_nation_recno])
 				return 0;
 
-			if(!locPtr->walkable())
+			if(!(world.pass_map.get(locOffset) & PASS_LAND))
 				return 0;
-			
-			if(!recno)
+
+			if(!(world.occupy_map.get(locOffset) & OCCUPY_GROUND))
 				return 1;
 
+			recno = locPtr->cargo_recno;
+
 			unitPtr = unit_array[recno];
 			if(search_mode==SEARCH_MODE_A_UNIT_IN_GROUP)
 				return unitPtr->cur_action==SPRITE_MOVE;
@@ -83,12 +86,14 @@ int SeekPathReuse::can_walk(int xLoc, int yLoc)
 			break;
 
 		case UNIT_SEA:
-			if(!locPtr->sailable())
+			if(!(world.pass_map.get(locOffset) & PASS_SEA))
 				return 0;
 
-			if(!recno)
+			if(!(world.occupy_map.get(locOffset) & OCCUPY_GROUND))
 				return 1;
 
+			recno = locPtr->cargo_recno;
+
 			unitPtr = unit_array[recno];
 			if(search_mode==SEARCH_MODE_A_UNIT_IN_GROUP)
 				return unitPtr->cur_action==SPRITE_MOVE;
@@ -103,9 +108,11 @@ int SeekPathReuse::can_walk(int xLoc, int yLoc)
 			break;
 
 		case UNIT_AIR:
-			if(!recno)
+			if(!(world.occupy_map.get(locOffset) & OCCUPY_AIR))
 				return 1;
 
+			recno = locPtr->air_cargo_recno;
+
 			unitPtr = unit_array[recno];
 			if(search_mode==SEARCH_MODE_A_UNIT_IN_GROUP)
 				return unitPtr->cur_action==SPRITE_MOVE;
@@ -172,8 +172,6 @@ void SpriteArray::del(int recNo)
 //--------- Begin of function SpriteArray::process ---------//
 void SpriteArray::process()
 {
-	#define SYS_YIELD_INTERVAL	20
-	
 	Sprite* spritePtr;
 	int arraySize = size();
 	if(arraySize<1)
@@ -186,7 +184,6 @@ void SpriteArray::process()
 	//restart_recno = 0;
 	int newRecno = 0;
 	//#### end alex 3/10 ####//
-	int sysYieldCount = arraySize - arraySize%SYS_YIELD_INTERVAL;
 
 	//### begin alex 3/10 ###//
 	#ifdef DEBUG
@@ -196,13 +193,6 @@ void SpriteArray::process()
 
 	for(int j=arraySize; j; --j, ++i) //for(int j=1; j<=arraySize; j++, i++)
 	{
-		//-------- system yield ---------//
-		if(j==sysYieldCount)
-		{
-			sysYieldCount -= SYS_YIELD_INTERVAL;
-			sys.yield();
-		}
-
 		if(i>arraySize)
 			i = 1;
 
@@ -0,0 +1,323 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : OSPRLOAD.CPP
+//Description : Object SpriteLoader
+
+#include <stdio.h>
+#include <string.h>
+#include <ALL.h>
+#include <OMISC.h>
+#include <OSTR.h>
+#include <OSPRTRES.h>
+#include <OUNITRES.h>
+#include <OSPRLOAD.h>
+#include <dbglog.h>
+
+DBGLOG_DEFAULT_CHANNEL(SpriteLoader);
+
+//------- Begin of function SpriteLoader::SpriteLoader -------//
+
+SpriteLoader::SpriteLoader()
+{
+	memset( request_array, 0, sizeof(request_array) );
+
+	quit_flag = false;
+}
+//-------- End of function SpriteLoader::SpriteLoader --------//
+
+
+//------- Begin of function SpriteLoader::deinit -------//
+//
+// Stop the loading thread and free the files not taken. Called before
+// sprite_res is freed.
+//
+void SpriteLoader::deinit()
+{
+	if( load_thread.joinable() )
+	{
+		{
+			std::lock_guard<std::mutex> lock(load_mutex);
+			quit_flag = true;
+		}
+
+		load_cond.notify_all();
+		load_thread.join();
+	}
+
+	quit_flag = false;
+
+	for( int i=0 ; i<MAX_SPRITE_LOAD ; i++ )
+		free_request( request_array+i );
+}
+//-------- End of function SpriteLoader::deinit --------//
+
+
+//------- Begin of function SpriteLoader::prefetch -------//
+//
+// Start reading the bitmap file of a sprite in the background, unless
+// it has been loaded or requested already.
+//
+// <int> spriteId = id. of the sprite in sprite_res
+//
+void SpriteLoader::prefetch(int spriteId)
+{
+	if( spriteId < 1 || spriteId > sprite_res.sprite_info_count )
+		return;
+
+	SpriteInfo* spriteInfo = sprite_res[spriteId];
+
+	if( spriteInfo->res_bitmap.initialized() )
+		return;
+
+	std::unique_lock<std::mutex> lock(load_mutex);
+
+	if( get_request(spriteInfo) )
+		return;
+
+	//--- get an empty entry, or replace the oldest file not taken ---//
+
+	SpriteLoadRequest* requestPtr = NULL;
+	int i;
+
+	for( i=0 ; i<MAX_SPRITE_LOAD ; i++ )
+	{
+		SpriteLoadRequest* curRequest = request_array+i;
+
+		if( curRequest->status == SPRITE_LOAD_EMPTY )
+		{
+			requestPtr = curRequest;
+			break;
+		}
+
+		if( (curRequest->status == SPRITE_LOAD_DONE || curRequest->status == SPRITE_LOAD_FAILED) &&
+			 (!requestPtr || curRequest->request_time < requestPtr->request_time) )
+		{
+			requestPtr = curRequest;
+		}
+	}
+
+	if( !requestPtr )		// all are being read
+		return;
+
+	free_request( requestPtr );
+
+	//---------- queue the request ---------//
+
+	String str;
+
+	str  = DIR_SPRITE;
+	str += spriteInfo->sprite_code;
+	str += ".SPR";
+
+	strncpy( requestPtr->file_name, str, FilePath::MAX_FILE_PATH );
+	requestPtr->file_name[FilePath::MAX_FILE_PATH] = '\0';
+
+	requestPtr->sprite_info  = spriteInfo;
+	requestPtr->request_time = misc.get_time();
+	requestPtr->status       = SPRITE_LOAD_QUEUED;
+
+	if( !load_thread.joinable() )
+		load_thread = std::thread(&SpriteLoader::load_main, this);
+
+	lock.unlock();
+	load_cond.notify_one();
+}
+//-------- End of function SpriteLoader::prefetch --------//
+
+
+//------- Begin of function SpriteLoader::prefetch_unit -------//
+
+void SpriteLoader::prefetch_unit(int unitId)
+{
+	if( unitId < 1 || unitId > unit_res.unit_info_count )
+		return;
+
+	prefetch( unit_res[unitId]->sprite_id );
+}
+//-------- End of function SpriteLoader::prefetch_unit --------//
+
+
+//------- Begin of function SpriteLoader::take -------//
+//
+// Give the file read in the background to the sprite's res_bitmap.
+//
+// return : <int> 1 - the file has been taken
+//                0 - it has not been requested, is still being read or could not be read
+//
+int SpriteLoader::take(SpriteInfo* spriteInfo)
+{
+	std::lock_guard<std::mutex> lock(load_mutex);
+
+	SpriteLoadRequest* requestPtr = get_request(spriteInfo);
+
+	if( !requestPtr )
+		return 0;
+
+	if( requestPtr->status == SPRITE_LOAD_FAILED )		// leave it to SpriteInfo to read it and report the error
+	{
+		free_request( requestPtr );
+		return 0;
+	}
+
+	if( requestPtr->status != SPRITE_LOAD_DONE )
+		return 0;
+
+	spriteInfo->res_bitmap.init_imported_buf( requestPtr->data_buf, requestPtr->data_size );		// res_bitmap frees it
+
+	requestPtr->data_buf = NULL;
+
+	MSG("%s read in %lu ms, taken %lu ms after it was requested\n", requestPtr->file_name,
+		requestPtr->read_ms, misc.get_time() - requestPtr->request_time);
+
+	free_request( requestPtr );
+
+	return 1;
+}
+//-------- End of function SpriteLoader::take --------//
+
+
+//------- Begin of function SpriteLoader::is_pending -------//
+//
+// Whether the file of the sprite is queued or being read.
+//
+int SpriteLoader::is_pending(SpriteInfo* spriteInfo)
+{
+	std::lock_guard<std::mutex> lock(load_mutex);
+
+	SpriteLoadRequest* requestPtr = get_request(spriteInfo);
+
+	return requestPtr && ( requestPtr->status == SPRITE_LOAD_QUEUED ||
+								  requestPtr->status == SPRITE_LOAD_READING );
+}
+//-------- End of function SpriteLoader::is_pending --------//
+
+
+//------- Begin of function SpriteLoader::get_request -------//
+//
+// load_mutex must be locked by the caller.
+//
+SpriteLoadRequest* SpriteLoader::get_request(SpriteInfo* spriteInfo)
+{
+	for( int i=0 ; i<MAX_SPRITE_LOAD ; i++ )
+	{
+		if( request_array[i].status != SPRITE_LOAD_EMPTY &&
+			 request_array[i].sprite_info == spriteInfo )
+		{
+			return request_array+i;
+		}
+	}
+
+	return NULL;
+}
+//-------- End of function SpriteLoader::get_request --------//
+
+
+//------- Begin of function SpriteLoader::free_request -------//
+//
+// load_mutex must be locked by the caller, and the request must not be
+// being read.
+//
+void SpriteLoader::free_request(SpriteLoadRequest* requestPtr)
+{
+	err_when( requestPtr->status == SPRITE_LOAD_READING );
+
+	if( requestPtr->data_buf )
+		mem_del( requestPtr->data_buf );
+
+	memset( requestPtr, 0, sizeof(SpriteLoadRequest) );
+}
+//-------- End of function SpriteLoader::free_request --------//
+
+
+//------- Begin of function SpriteLoader::load_main -------//
+//
+// The loading thread. It only reads the files, everything else is done
+// by the main thread.
+//
+void SpriteLoader::load_main()
+{
+	std::unique_lock<std::mutex> lock(load_mutex);
+
+	for( ;; )
+	{
+		SpriteLoadRequest* requestPtr = NULL;
+
+		load_cond.wait( lock, [&]()
+		{
+			if( quit_flag )
+				return true;
+
+			for( int i=0 ; i<MAX_SPRITE_LOAD ; i++ )
+			{
+				if( request_array[i].status == SPRITE_LOAD_QUEUED )
+				{
+					requestPtr = request_array+i;
+					return true;
+				}
+			}
+
+			return false;
+		} );
+
+		if( quit_flag )
+			return;
+
+		requestPtr->status = SPRITE_LOAD_READING;
+
+		char fileName[FilePath::MAX_FILE_PATH+1];
+		strcpy( fileName, requestPtr->file_name );
+
+		lock.unlock();
+
+		//--------- read the whole file ---------//
+
+		unsigned long startTime = misc.get_time();
+		char* dataBuf = NULL;
+		long  dataSize = 0;
+		FILE* filePtr = fopen(fileName, "rb");
+
+		if( filePtr )
+		{
+			if( fseek(filePtr, 0, SEEK_END)==0 && (dataSize = ftell(filePtr)) > 0 &&
+				 fseek(filePtr, 0, SEEK_SET)==0 )
+			{
+				dataBuf = mem_add( dataSize );
+
+				if( fread(dataBuf, 1, dataSize, filePtr) != (size_t) dataSize )
+				{
+					mem_del( dataBuf );
+					dataBuf = NULL;
+				}
+			}
+
+			fclose( filePtr );
+		}
+
+		lock.lock();
+
+		requestPtr->data_buf  = dataBuf;
+		requestPtr->data_size = dataBuf ? (int) dataSize : 0;
+		requestPtr->read_ms   = misc.get_time() - startTime;
+		requestPtr->status    = dataBuf ? SPRITE_LOAD_DONE : SPRITE_LOAD_FAILED;
+	}
+}
+//-------- End of function SpriteLoader::load_main --------//
@@ -27,6 +27,10 @@
 #include <OGAMESET.h>
 #include <OSPRTRES.h>
 #include <OWEATHER.h>
+#include <OSPRLOAD.h>
+#include <dbglog.h>
+
+DBGLOG_DEFAULT_CHANNEL(SpriteRes);
 
 
 //-------- define file name -----------//
@@ -336,6 +340,20 @@ void SpriteInfo::load_bitmap_res()
 	if( ++loaded_count > 1 )		// if bitmaps of this sprite has been loaded
 		return;
 
+	//--- use the file if it has been read in the background, or wait for it ---//
+
+	if( sprite_loader.take(this) || sprite_loader.is_pending(this) )
+		return;
+
+	read_bitmap_file();
+}
+//-------- End of function SpriteInfo::load_bitmap_res -------//
+
+
+//------- Begin of function SpriteInfo::read_bitmap_file -------//
+
+void SpriteInfo::read_bitmap_file()
+{
 	//----- open sprite bitmap resource file -------//
 
 	String str;
@@ -344,9 +362,42 @@ void SpriteInfo::load_bitmap_res()
 	str += sprite_code;
 	str += ".SPR";
 
+#if defined(DEBUG) || defined(DEBUG_ENABLE_MESSAGES)
+	unsigned long startTime = misc.get_time();
+#endif
+
 	res_bitmap.init_imported(str, 1);  // 1-read all into buffer
+
+#if defined(DEBUG) || defined(DEBUG_ENABLE_MESSAGES)
+	MSG("%s read in %lu ms when it was needed\n", (char*) str, misc.get_time() - startTime);
+#endif
 }
-//-------- End of function SpriteInfo::load_bitmap_res -------//
+//-------- End of function SpriteInfo::read_bitmap_file -------//
+
+
+//------- Begin of function SpriteInfo::is_bitmap_ready -------//
+//
+// Whether the bitmaps can be drawn. They may still be read by
+// sprite_loader, then the sprite is not drawn.
+//
+int SpriteInfo::is_bitmap_ready()
+{
+	if( res_bitmap.initialized() )
+		return 1;
+
+	if( !loaded_count )
+		return 0;
+
+	if( sprite_loader.take(this) )
+		return 1;
+
+	if( sprite_loader.is_pending(this) )
+		return 0;
+
+	read_bitmap_file();		// it could not be read in the background
+	return 1;
+}
+//-------- End of function SpriteInfo::is_bitmap_ready -------//
 
 
 //------- Begin of function SpriteInfo::free_bitmap_res -------//
@@ -45,6 +45,7 @@
 #include <OGAMESET.h>
 #include <OSaveGameArray.h>
 #include <OSaveGameProvider.h>
+#include <OSaveGameIndex.h>
 #include <OGAMHALL.h>
 #include <OINFO.h>
 #include <OIMGRES.h>
@@ -52,6 +53,7 @@
 #include <OMOUSE2.h>
 #include <KEY.h>
 #include <OMOUSECR.h>
+#include <OINITGRF.h>
 #include <OUNIT.h>
 #include <OSITE.h>
 #include <OSPATH.h>
@@ -59,6 +61,7 @@
 #include <OSPY.h>
 #include <OSYS.h>
 #include <OREMOTE.h>
+#include <OMPRESYN.h>
 #include <OTECHRES.h>
 #include <OGODRES.h>
 #include <OHELP.h>
@@ -86,6 +89,7 @@
 #include <CmdLine.h>
 #include <FilePath.h>
 #include <ConfigAdv.h>
+#include <ReplayCheck.h>
 
 #include <dbglog.h>
 #ifdef USE_WINDOWS
@@ -348,21 +352,10 @@ void Sys::deinit_directx()
 //--------- End of function Sys::deinit_directx ---------//
 
 
-//------- Begin of function Sys::init_objects -----------//
-//
-// Initialize system objects which do not change from games to games.
+//-------- Begin of static function init_fonts --------//
 //
-int Sys::init_objects()
+static void init_fonts()
 {
-   //--------- init system class ----------//
-
-   mouse_cursor.init();
-   mouse_cursor.set_frame_border(ZOOM_X1,ZOOM_Y1,ZOOM_X2,ZOOM_Y2);
-
-   mouse.init();
-
-   //------- init resource class ----------//
-
    if( locale_res.fontset[0] )
    {
       String font;
@@ -411,23 +404,64 @@ int Sys::init_objects()
       // use correct conversion for non-localized fonts
       font_hitpoint.cd = locale_res.cd_latin;
    #endif
+}
+//---------- End of static function init_fonts --------//
 
-   image_icon.init(DIR_RES"I_ICON.RES",1,0);       // 1-read into buffer
-   image_interface.init(DIR_RES"I_IF.RES",0,0);    // 0-don't read into the buffer, don't use common buffer
+
+//------- Begin of function Sys::init_objects -----------//
+//
+// Initialize system objects which do not change from games to games.
+//
+int Sys::init_objects()
+{
+   //--------- init system class ----------//
+
+   mouse_cursor.init();
+   mouse_cursor.set_frame_border(ZOOM_X1,ZOOM_Y1,ZOOM_X2,ZOOM_Y2);
+
+   mouse.init();
+
+   //------- init resource class ----------//
+
+   InitGraph initGraph("Sys::init_objects");
+   std::vector<std::string> fontFileArray;
+
+   static const char* fontNameArray[] = { "STD", "SAN", "MID", "SMAL", "NEWS", "CASA" };
+
+   for( int i=0 ; i<(int)(sizeof(fontNameArray)/sizeof(fontNameArray[0])) ; i++ )
+   {
+      std::string fontFile = std::string(DIR_RES"FNT_") + fontNameArray[i];
+
+      if( locale_res.fontset[0] )
+         fontFile = fontFile + "_" + locale_res.fontset;
+
+      fontFileArray.push_back( fontFile + ".RES" );
+   }
+
+   fontFileArray.push_back( DIR_RES"FNT_HITP.RES" );
+
+   // these inits only read their own files, they run on worker threads
+
+   initGraph.add_step( "fonts", init_fonts, {}, fontFileArray, 1 );
+
+   initGraph.add_step( "image_icon", []() { image_icon.init(DIR_RES"I_ICON.RES",1,0); }, {}, { DIR_RES"I_ICON.RES" }, 1 );       // 1-read into buffer
+   initGraph.add_step( "image_interface", []() { image_interface.init(DIR_RES"I_IF.RES",0,0); }, {}, {}, 1 );    // 0-don't read into the buffer, don't use common buffer
 
    #ifndef DEMO         // do not load these in the demo verison
-      image_menu.init(DIR_RES"I_MENU.RES",0,0);       // 0-don't read into the buffer, don't use common buffer
-      image_encyc.init(DIR_RES"I_ENCYC.RES",0,0); // 0-don't read into the buffer, don't use common buffer
+      initGraph.add_step( "image_menu", []() { image_menu.init(DIR_RES"I_MENU.RES",0,0); }, {}, {}, 1 );       // 0-don't read into the buffer, don't use common buffer
+      initGraph.add_step( "image_encyc", []() { image_encyc.init(DIR_RES"I_ENCYC.RES",0,0); }, {}, {}, 1 ); // 0-don't read into the buffer, don't use common buffer
    #endif
 
-   image_button.init(DIR_RES"I_BUTTON.RES",1,0);
-   image_spict.init(DIR_RES"I_SPICT.RES",1,0);
-   image_tutorial.init(DIR_RES"TUT_PICT.RES",0,0);
+   initGraph.add_step( "image_button", []() { image_button.init(DIR_RES"I_BUTTON.RES",1,0); }, {}, { DIR_RES"I_BUTTON.RES" }, 1 );
+   initGraph.add_step( "image_spict", []() { image_spict.init(DIR_RES"I_SPICT.RES",1,0); }, {}, { DIR_RES"I_SPICT.RES" }, 1 );
+   initGraph.add_step( "image_tutorial", []() { image_tutorial.init(DIR_RES"TUT_PICT.RES",0,0); }, {}, {}, 1 );
 
 		#ifndef DEMO         // do not load these in the demo verison
-			image_menu_plus.init(DIR_RES"I_MENU2.RES",0,0);       // 0-don't read into the buffer, don't use common buffer
+			initGraph.add_step( "image_menu_plus", []() { image_menu_plus.init(DIR_RES"I_MENU2.RES",0,0); }, {}, {}, 1 );       // 0-don't read into the buffer, don't use common buffer
 		#endif
 
+   initGraph.run();
+
    seek_path.init(MAX_BACKGROUND_NODE);
    seek_path_reuse.init(MAX_BACKGROUND_NODE);
    group_select.init();
@@ -855,6 +889,8 @@ void Sys::main_loop(int isLoadedGame)
                   crc_store.record_all();
                   if( !remote.is_replay() )
                      crc_store.send_frame();
+                  else
+                     replay_check.add_crc(frame_count);
                }
                // ###### patch end Gilbert 20/1 ######//
 
@@ -987,6 +1023,10 @@ void Sys::main_loop(int isLoadedGame)
             }
          }
 
+         //------ resync the game when it is out of sync ------//
+
+         mp_resync.process();
+
 		Ambition::Control::unlockBuffer(vga_front);
 
       if (config.frame_speed < 99) {
@@ -1069,6 +1109,7 @@ void Sys::auto_save()
                remove( auto2_path );
 
             rename( auto1_path, auto2_path );
+            save_game_index.forget("AUTO2.SAV");   // renamed files keep their time
          }
 
          SaveGameProvider::save_game("AUTO.SAV");
@@ -1118,6 +1159,7 @@ void Sys::auto_save()
             remove( auto2_path );
 
          rename( auto1_path, auto2_path );
+         save_game_index.forget("AUTO2.SVM");   // renamed files keep their time
       }
 
       SaveGameProvider::save_game("AUTO.SVM");
@@ -1391,6 +1433,7 @@ int Sys::is_mp_sync(int *unreadyPlayerFlag)
    //------ pre_process MSG_NEXT_FRAME in the queue -----//
 
    remote.process_specific_msg(MSG_NEXT_FRAME);
+   remote.process_specific_msg(MSG_RESYNC_DATA);		// data sent before the resync frame is reached
 
 #ifdef DEBUG
    DEBUG_LOG("begin nation's next_frame_ready");
@@ -2578,6 +2621,12 @@ void Sys::set_speed(int frameSpeed, int remoteCall)
 {
    short requested_speed;
 
+   //--- replays being checked ignore the recorded speed changes, so that ---//
+   //--- the time taken is the time of the simulation, see ReplayCheck    ---//
+
+   if( replay_check.is_active() )
+      frameSpeed = 99;
+
    if( frameSpeed > 0 )
    {
       // set the game speed
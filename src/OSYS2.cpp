@@ -43,6 +43,7 @@
 #include <OINFO.h>
 #include <OGAME.h>
 #include <OWORLD.h>
+#include <OFLTREC.h>
 #include <OSYS.h>
 #include <ORAWRES.h>
 #include <OTALKRES.h>
@@ -61,7 +62,12 @@
 #include <OFIRMDIE.h>
 #include <OOPTMENU.h>
 #include <OINGMENU.h>
+#include <ORENDSNP.h>
+#include <OTEXTCAC.h>
+#include <ReplayCheck.h>
 #include <CmdLine.h>
+#include <OMEMSTAT.h>
+#include <OSPATHC.h>
 #include <gettext.h>
 
 
@@ -121,6 +127,10 @@ void Sys::process()
 	frame_count++;
 	is_sync_frame = frame_count%3==0;	// check if sychronization should take place at this frame (for handling one sync per n frames)
 
+	MemStat::next_frame();
+
+	replay_check.begin_frame();
+
 	//--------- process objects -----------//
 
 	LOG_MSG(misc.get_random_seed());
@@ -128,41 +138,55 @@ void Sys::process()
 	unit_array.process();
 	seek_path.reset_total_node_avail();	// reset node for seek_path
 	LOG_MSG("end unit_array.process()");
+	replay_check.end_step(ReplayCheck::STEP_UNIT);
+	FLIGHT_REC("unit_array.process", unit_array.size());
 	LOG_MSG(misc.get_random_seed());
 
 	LOG_MSG("begin firm_array.process()");
 	firm_array.process();
 	LOG_MSG("end firm_array.process()");
+	replay_check.end_step(ReplayCheck::STEP_FIRM);
+	FLIGHT_REC("firm_array.process", firm_array.size());
 	LOG_MSG(misc.get_random_seed());
 
 	LOG_MSG("begin town_array.process()");
 	town_array.process();
 	LOG_MSG("end town_array.process()");
+	replay_check.end_step(ReplayCheck::STEP_TOWN);
+	FLIGHT_REC("town_array.process", town_array.size());
 	LOG_MSG(misc.get_random_seed());
 
 	LOG_MSG("begin nation_array.process()");
 	nation_array.process();
 	LOG_MSG("end nation_array.process()");
+	replay_check.end_step(ReplayCheck::STEP_NATION);
+	FLIGHT_REC("nation_array.process", nation_array.size());
 	LOG_MSG(misc.get_random_seed());
 
 	LOG_MSG("begin bullet_array.process()");
 	bullet_array.process();
 	LOG_MSG("end bullet_array.process()");
+	replay_check.end_step(ReplayCheck::STEP_BULLET);
+	FLIGHT_REC("bullet_array.process", bullet_array.size());
 	LOG_MSG(misc.get_random_seed());
 
 	LOG_MSG("begin world.process()");
 	world.process();
 	LOG_MSG("end world.process()");
+	replay_check.end_step(ReplayCheck::STEP_WORLD);
+	FLIGHT_REC("world.process", 0);
 	LOG_MSG(misc.get_random_seed());
 
 	LOG_MSG("begin tornado_array.process()");
 	tornado_array.process();
 	LOG_MSG("begin tornado_array.process()");
+	FLIGHT_REC("tornado_array.process", tornado_array.size());
 	LOG_MSG(misc.get_random_seed());
 
 	LOG_MSG("begin snow_ground_array.process()");
 	snow_ground_array.process();
 	LOG_MSG("end snow_ground_array.process()");
+	FLIGHT_REC("snow_ground_array.process", 0);
 	LOG_MSG(misc.get_random_seed());
 
 	if (!Ambition::Config::enhancementsAvailable()) {
@@ -180,6 +204,7 @@ void Sys::process()
 	LOG_MSG("begin effect_array.process()");
 	effect_array.process();
 	LOG_MSG("end effect_array.process()");
+	FLIGHT_REC("effect_array.process", effect_array.size());
 	LOG_MSG(misc.get_random_seed());
 
 	LOG_MSG("begin war_point_array.process()");
@@ -197,6 +222,7 @@ void Sys::process()
 		LOG_MSG("begin info.next_day()");
 		info.next_day();
 		LOG_MSG("end info.next_day()");
+		FLIGHT_REC("info.next_day", info.game_date);
 		LOG_MSG(misc.get_random_seed());
 
 		LOG_MSG("begin world.next_day()");
@@ -238,11 +264,18 @@ void Sys::process()
 		LOG_MSG("begin region_array.next_day()");
 		region_array.next_day();
 		LOG_MSG("end region_array.next_day()");
+		FLIGHT_REC("region_array.next_day", region_array.region_info_count);
 		LOG_MSG(misc.get_random_seed());
 
 		day_frame_count = 0;
 	}
 
+	replay_check.end_step(ReplayCheck::STEP_OTHER);
+
+	//--- keep the unit positions for drawing between frames ---//
+
+	render_snapshot.take();
+
 	//------ display the current frame ------//
 
 	LOG_MSG("begin sys.disp_frame");
@@ -543,6 +576,8 @@ void Sys::disp_frame()
 			rock_array.process();
 		}
 
+		render_snapshot.begin_draw();
+
 		// -------- re-draw the whole screen if needed, such as after task switching ---------//
 
 		if( need_redraw_flag )
@@ -709,6 +744,9 @@ void Sys::update_view()
 			firm_array.draw_profile();
 			town_array.draw_profile();
 			unit_array.draw_profile();
+			MemStat::draw_profile();
+			seek_path_cache.draw_profile();
+			text_cache.draw_profile();
 
 			vga.use_front();
 		}
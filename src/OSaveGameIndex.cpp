@@ -0,0 +1,349 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OSaveGameIndex.cpp
+//Description : Cache of the savegame headers
+
+#include <string.h>
+#include <unordered_map>
+
+#include <OSaveGameIndex.h>
+#include <OSYS.h>
+#include <OMISC.h>
+#include <OFILE.h>
+#include <OGFILE.h>
+#include <FilePath.h>
+#include <dbglog.h>
+
+#ifdef USE_WINDOWS
+#include <io.h>
+#endif
+#ifdef USE_POSIX
+#include <unistd.h>
+#endif
+
+DBGLOG_DEFAULT_CHANNEL(SaveGameIndex);
+
+
+//--------- Define constant ---------//
+
+enum { INDEX_VERSION = 1 };
+
+//------ Define struct SaveGameIndexHeader ------//
+
+#pragma pack(1)
+struct SaveGameIndexHeader
+{
+	char     magic[4];
+	uint16_t version;
+	uint32_t record_size;		// sizeof(SaveGame), the index is dropped if the layout changes
+	uint32_t record_count;
+};
+#pragma pack()
+
+static const char INDEX_MAGIC[4] = { '7', 'K', 'S', 'I' };
+
+//------- Declare static functions ----------//
+
+static bool index_file_path(FilePath& /*out*/ filePath, const char* filenameWildcard);
+static bool scan_savegames(const char* filenameWildcard, const std::vector<SaveGame>& oldList, std::vector<SaveGame>& /*out*/ newList);
+
+
+//-------- Begin of function SaveGameIndex destructor --------//
+//
+SaveGameIndex::~SaveGameIndex()
+{
+	if( scan_thread.joinable() )
+		scan_thread.join();
+}
+//-------- End of function SaveGameIndex destructor --------//
+
+
+//-------- Begin of function SaveGameIndex::prefetch --------//
+//
+// Starts rescanning the savegames matching filenameWildcard on a worker
+// thread. The worker only works on copies, the result is taken over by
+// the next enumerate() of the same wildcard.
+//
+void SaveGameIndex::prefetch(const char* filenameWildcard)
+{
+	if( scan_thread.joinable() )		// one scan at a time
+		return;
+
+	scan_wildcard = filenameWildcard;
+	scan_list.clear();
+	scan_changed = false;
+	scan_stale = false;
+
+	std::vector<SaveGame> oldList = get_list(filenameWildcard);
+
+	scan_thread = std::thread([this, oldList]() {
+		scan_changed = scan_savegames(scan_wildcard.c_str(), oldList, scan_list);
+	});
+}
+//-------- End of function SaveGameIndex::prefetch --------//
+
+
+//-------- Begin of function SaveGameIndex::enumerate --------//
+//
+// Enumerates all the savegames that match the wildcard pattern, calling callback for each savegame.
+//
+void SaveGameIndex::enumerate(const char* filenameWildcard, const std::function<void(const SaveGame* saveGame)>& callback)
+{
+	bool prefetched = false;
+
+	if( scan_thread.joinable() )
+	{
+		prefetched = scan_wildcard == filenameWildcard && !scan_stale;
+		finish_prefetch();
+	}
+
+	std::vector<SaveGame>& saveGameList = get_list(filenameWildcard);
+
+	if( !prefetched )
+	{
+		std::vector<SaveGame> newList;
+
+		if( scan_savegames(filenameWildcard, saveGameList, newList) )
+		{
+			saveGameList.swap(newList);
+			write_index(filenameWildcard, saveGameList);
+		}
+	}
+
+	for( size_t i=0 ; i<saveGameList.size() ; i++ )
+	{
+		if( saveGameList[i].header.terrain_set > 0 )		// skip files that are not savegames
+			callback(&saveGameList[i]);
+	}
+}
+//-------- End of function SaveGameIndex::enumerate --------//
+
+
+//-------- Begin of function SaveGameIndex::forget --------//
+//
+// Drops the entry of a savegame that has been written, renamed or deleted,
+// so it is read again on the next scan even if its size and time happen
+// to match the old entry.
+//
+void SaveGameIndex::forget(const char* saveGameName)
+{
+	if( scan_thread.joinable() )
+		scan_stale = true;
+
+	for( auto& it : list_map )
+	{
+		std::vector<SaveGame>& saveGameList = it.second;
+
+		for( size_t i=0 ; i<saveGameList.size() ; i++ )
+		{
+			if( strcmp(saveGameList[i].file_info.name, saveGameName)==0 )
+			{
+				saveGameList.erase(saveGameList.begin()+i);
+				break;
+			}
+		}
+	}
+}
+//-------- End of function SaveGameIndex::forget --------//
+
+
+//-------- Begin of function SaveGameIndex::finish_prefetch --------//
+//
+// Waits for the worker and takes over its result if it is still valid.
+//
+void SaveGameIndex::finish_prefetch()
+{
+	scan_thread.join();
+
+	if( scan_stale || !scan_changed )
+		return;
+
+	std::vector<SaveGame>& saveGameList = get_list(scan_wildcard.c_str());
+
+	saveGameList.swap(scan_list);
+	write_index(scan_wildcard.c_str(), saveGameList);
+}
+//-------- End of function SaveGameIndex::finish_prefetch --------//
+
+
+//-------- Begin of function SaveGameIndex::get_list --------//
+//
+// Returns the cached list of the wildcard, reading it from the index file
+// the first time. A missing or outdated index gives an empty list, which
+// makes the next scan read all the headers.
+//
+std::vector<SaveGame>& SaveGameIndex::get_list(const char* filenameWildcard)
+{
+	auto it = list_map.find(filenameWildcard);
+
+	if( it != list_map.end() )
+		return it->second;
+
+	std::vector<SaveGame>& saveGameList = list_map[filenameWildcard];
+
+	FilePath full_path(sys.dir_config);
+	File file;
+	SaveGameIndexHeader indexHeader;
+
+	if( !index_file_path(full_path, filenameWildcard) || !misc.is_file_exist(full_path) )
+		return saveGameList;
+
+	if( !file.file_open(full_path, 0) ||		// 0=don't handle error itself
+		 !file.file_read(&indexHeader, sizeof(indexHeader)) ||
+		 memcmp(indexHeader.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) ||
+		 indexHeader.version != INDEX_VERSION ||
+		 indexHeader.record_size != sizeof(SaveGame) ||
+		 file.file_size() != (long) (sizeof(indexHeader) + sizeof(SaveGame) * indexHeader.record_count) )
+	{
+		MSG("Ignoring savegame index %s\n", (const char*) full_path);
+		return saveGameList;
+	}
+
+	if( indexHeader.record_count > 0 )
+	{
+		saveGameList.resize(indexHeader.record_count);
+
+		if( !file.file_read(saveGameList.data(), sizeof(SaveGame) * indexHeader.record_count) )
+			saveGameList.clear();
+	}
+
+	return saveGameList;
+}
+//-------- End of function SaveGameIndex::get_list --------//
+
+
+//-------- Begin of function SaveGameIndex::write_index --------//
+//
+void SaveGameIndex::write_index(const char* filenameWildcard, const std::vector<SaveGame>& saveGameList)
+{
+	FilePath full_path(sys.dir_config);
+	File file;
+	SaveGameIndexHeader indexHeader;
+
+	if( !index_file_path(full_path, filenameWildcard) )
+		return;
+
+	memcpy(indexHeader.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+	indexHeader.version = INDEX_VERSION;
+	indexHeader.record_size = sizeof(SaveGame);
+	indexHeader.record_count = saveGameList.size();
+
+	int rc = file.file_create(full_path, 0);		// 0=don't handle error itself
+
+	if( rc )
+		rc = file.file_write(&indexHeader, sizeof(indexHeader));
+
+	if( rc && saveGameList.size() > 0 )
+		rc = file.file_write((void*) saveGameList.data(), sizeof(SaveGame) * saveGameList.size());
+
+	file.file_close();
+
+	if( !rc )
+		unlink(full_path);		// a partial index would be dropped on reading anyway
+}
+//-------- End of function SaveGameIndex::write_index --------//
+
+
+//-------- Begin of static function index_file_path --------//
+//
+// The index of "*.SAV" is SAVINDEX.DAT, so it never matches the wildcard itself.
+//
+static bool index_file_path(FilePath& /*out*/ filePath, const char* filenameWildcard)
+{
+	const char* ext = strrchr(filenameWildcard, '.');
+	char fileName[FilePath::MAX_FILE_PATH];
+
+	snprintf(fileName, sizeof(fileName), "%sINDEX.DAT", ext ? ext+1 : "");
+
+	filePath += fileName;
+
+	return !filePath.error_flag;
+}
+//-------- End of static function index_file_path --------//
+
+
+//-------- Begin of static function scan_savegames --------//
+//
+// Builds the list of savegames matching filenameWildcard. Headers are
+// taken from oldList when the file size and modification time match,
+// all other files are opened. Files whose header cannot be read are kept
+// with a blank header, so they are not opened again until they change.
+//
+// May be called from the prefetch thread, so it must not touch any game
+// state other than reading sys.dir_config.
+//
+// return : <bool> true if newList differs from oldList.
+//
+static bool scan_savegames(const char* filenameWildcard, const std::vector<SaveGame>& oldList, std::vector<SaveGame>& /*out*/ newList)
+{
+	FilePath full_path(sys.dir_config);
+
+	newList.clear();
+
+	full_path += filenameWildcard;
+	if( full_path.error_flag )
+		return !oldList.empty();
+
+	Directory saveGameDirectory;
+	saveGameDirectory.read(full_path, 0);  // 0-Don't sort file names
+
+	std::unordered_map<std::string, const SaveGame*> oldMap;
+
+	for( size_t i=0 ; i<oldList.size() ; i++ )
+		oldMap[oldList[i].file_info.name] = &oldList[i];
+
+	bool changed = false;
+
+	for( int i=1 ; i<=saveGameDirectory.size() ; i++ )
+	{
+		const FileInfo* fileInfo = saveGameDirectory[i];
+		SaveGame saveGame;
+
+		saveGame.file_info = *fileInfo;
+
+		auto it = oldMap.find(fileInfo->name);
+
+		if( it != oldMap.end() &&
+			 it->second->file_info.size == fileInfo->size &&
+			 it->second->file_info.mod_time == fileInfo->mod_time )
+		{
+			saveGame.header = it->second->header;
+		}
+		else
+		{
+			FilePath save_game_path(sys.dir_config);
+
+			save_game_path += fileInfo->name;
+			if( save_game_path.error_flag )
+				continue;
+
+			changed = true;
+
+			if( !GameFile::read_header(save_game_path, &saveGame.header) )
+				memset(&saveGame.header, 0, sizeof(saveGame.header));
+		}
+
+		newList.push_back(saveGame);
+	}
+
+	return changed || newList.size() != oldList.size();
+}
+//-------- End of static function scan_savegames --------//
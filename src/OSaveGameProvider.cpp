@@ -24,6 +24,7 @@
 
 #include <OSaveGameArray.h>
 #include <OSaveGameProvider.h>
+#include <OSaveGameIndex.h>
 #include <OSaveGameInfo.h>
 #include <OMISC.h>
 #include <ODIR.h>
@@ -54,33 +55,9 @@ DBGLOG_DEFAULT_CHANNEL(SaveGameProvider);
 //
 void SaveGameProvider::enumerate_savegames(const char* filenameWildcard, const std::function<void(const SaveGame* saveGame)>& callback)
 {
-	FilePath full_path(sys.dir_config);
-
-	full_path += filenameWildcard;
-	if( full_path.error_flag )
-		return;
-
-	Directory saveGameDirectory;
-	saveGameDirectory.read(full_path, 0);  // 0-Don't sort file names
+	//---- only the headers of changed savegames are read, see SaveGameIndex ----//
 
-	//-------- read in the headers of all savegames -------//
-
-	for( int i=1 ; i<=saveGameDirectory.size() ; i++ )
-	{
-		const char* const saveGameName = saveGameDirectory[i]->name;
-		FilePath save_game_path(sys.dir_config);
-
-		save_game_path += saveGameName;
-		if( save_game_path.error_flag )
-			continue;
-
-		SaveGame saveGame;
-		if( GameFile::read_header(save_game_path, &saveGame.header) )
-		{
-			saveGame.file_info = *saveGameDirectory[i];
-			callback(&saveGame);
-		}
-	}
+	save_game_index.enumerate(filenameWildcard, callback);
 }
 //-------- End of function SaveGameProvider::enumerate_savegames --------//
 
@@ -97,6 +74,7 @@ void SaveGameProvider::delete_savegame(const char* saveGameName) {
 		return;
 
 	unlink(full_path);
+	save_game_index.forget(saveGameName);
 }
 //-------- End of function SaveGameProvider::delete_savegame --------//
 
@@ -133,6 +111,8 @@ bool SaveGameProvider::save_game(const char* newFileName, SaveGameInfo* /*out*/
 	SaveGameInfo newSaveGameInfo = SaveGameInfoFromCurrentGame(newFileName);
 	success = success && GameFile::save_game(full_path, newSaveGameInfo);
 
+	save_game_index.forget(newFileName);		// even if failed, the file may have been overwritten
+
 	power.win_opened=0;
 
 	if (success)
@@ -196,13 +176,56 @@ int SaveGameProvider::load_scenario(const char* filePath)
 //               -1 - error and partially loaded
 //
 int SaveGameProvider::load_game_from_file(const char* filePath, SaveGameInfo* /*out*/ saveGameInfo)
+{
+	return run_load([&]() { return GameFile::load_game(filePath, /*out*/ saveGameInfo); });
+}
+//-------- End of function SaveGameProvider::load_game_from_file --------//
+
+
+//-------- Begin of function SaveGameProvider::save_game_mem --------//
+//
+// Save the current game into a memory file created with file_create_mem(0, 1).
+//
+bool SaveGameProvider::save_game_mem(File* filePtr)
+{
+	power.win_opened=1;				// to disable power.mouse_handler()
+
+	SaveGameInfo newSaveGameInfo = SaveGameInfoFromCurrentGame("");
+	bool success = GameFile::save_game_mem(filePtr, newSaveGameInfo);
+
+	power.win_opened=0;
+
+	return success;
+}
+//-------- End of function SaveGameProvider::save_game_mem --------//
+
+
+//-------- Begin of function SaveGameProvider::load_game_mem --------//
+//
+// Loads the game saved into a memory file by save_game_mem() as the current game.
+// return : <int> 1 - loaded successfully.
+//                0 - not loaded.
+//               -1 - error and partially loaded
+//
+int SaveGameProvider::load_game_mem(File* filePtr, SaveGameInfo* /*out*/ saveGameInfo)
+{
+	return run_load([&]() { return GameFile::load_game_mem(filePtr, /*out*/ saveGameInfo); });
+}
+//-------- End of function SaveGameProvider::load_game_mem --------//
+
+
+//-------- Begin of function SaveGameProvider::run_load --------//
+//
+// Runs the given load with the waiting cursor and the power disabled.
+//
+int SaveGameProvider::run_load(const std::function<int ()>& loadFunc)
 {
 	power.win_opened=1;				// to disable power.mouse_handler()
 	const int oldCursor = mouse_cursor.get_icon();
 	mouse_cursor.set_icon( CURSOR_WAITING );
 	const int powerEnableFlag = power.enable_flag;
 
-	int rc = GameFile::load_game(filePath, /*out*/ saveGameInfo);
+	int rc = loadFunc();
 
 	mouse_cursor.set_frame(0);		// to fix a frame bug with loading game
 
@@ -212,4 +235,4 @@ int SaveGameProvider::load_game_from_file(const char* filePath, SaveGameInfo* /*
 
 	return rc;
 }
-//-------- End of function SaveGameProvider::load_game_from_file --------//
+//-------- End of function SaveGameProvider::run_load --------//
@@ -0,0 +1,156 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : OTEXTCAC.CPP
+//Description : Object TextCache
+
+#include <stdio.h>
+#include <string.h>
+#include <ALL.h>
+#include <OFONT.h>
+#include <OWORLD.h>
+#include <OTEXTCAC.h>
+#include <dbglog.h>
+
+DBGLOG_DEFAULT_CHANNEL(TextCache);
+
+//------- Begin of function TextCache::TextCache -------//
+
+TextCache::TextCache()
+{
+	memset( entry_array, 0, sizeof(entry_array) );
+
+	hit_count = miss_count = 0;
+}
+//-------- End of function TextCache::TextCache --------//
+
+
+//------- Begin of function TextCache::deinit -------//
+
+void TextCache::deinit()
+{
+	if( hit_count || miss_count )
+		MSG("Text cache: %lu hits, %lu misses\n", hit_count, miss_count);
+
+	for( int i=0 ; i<TEXT_CACHE_SIZE ; i++ )
+		free_entry( entry_array+i );
+
+	hit_count = miss_count = 0;
+}
+//-------- End of function TextCache::deinit --------//
+
+
+//------- Begin of function TextCache::clear_font -------//
+//
+// Called when a font is deinitialized, as the texts kept for it were
+// laid out with its glyphs.
+//
+void TextCache::clear_font(Font* fontPtr)
+{
+	for( int i=0 ; i<TEXT_CACHE_SIZE ; i++ )
+	{
+		if( entry_array[i].font_ptr == fontPtr )
+			free_entry( entry_array+i );
+	}
+}
+//-------- End of function TextCache::clear_font --------//
+
+
+//------- Begin of function TextCache::get_entry -------//
+//
+// Return the entry of the text. If the text is not kept, the entry is
+// emptied for it, with its width and image still to be filled in by
+// Font.
+//
+// return : <TextCacheEntry*> the entry, NULL if the text is too long
+//                            to be cached
+//
+TextCacheEntry* TextCache::get_entry(Font* fontPtr, const char* textPtr)
+{
+	//------ hash the text and the font together -------//
+
+	uint32_t hashValue = 2166136261u ^ (uint32_t) (uintptr_t) fontPtr;
+	int textLen;
+
+	for( textLen=0 ; textPtr[textLen] ; textLen++ )
+	{
+		if( textLen==MAX_TEXT_CACHE_LEN )
+			return NULL;
+
+		hashValue = (hashValue ^ (unsigned char) textPtr[textLen]) * 16777619u;
+	}
+
+	TextCacheEntry* entryPtr = entry_array + ((hashValue ^ (hashValue >> 16)) & (TEXT_CACHE_SIZE-1));
+
+	if( entryPtr->font_ptr==fontPtr && !strcmp(entryPtr->text, textPtr) )
+	{
+		hit_count++;
+		return entryPtr;
+	}
+
+	//------- replace the text kept in the entry --------//
+
+	miss_count++;
+
+	free_entry(entryPtr);
+
+	entryPtr->font_ptr = fontPtr;
+	memcpy( entryPtr->text, textPtr, textLen+1 );
+
+	return entryPtr;
+}
+//-------- End of function TextCache::get_entry --------//
+
+
+//------- Begin of function TextCache::free_entry -------//
+
+void TextCache::free_entry(TextCacheEntry* entryPtr)
+{
+	if( entryPtr->span_bitmap )
+	{
+		mem_del( entryPtr->span_bitmap );
+		entryPtr->span_bitmap = NULL;
+	}
+
+	entryPtr->font_ptr   = NULL;
+	entryPtr->text_width = -1;
+	entryPtr->span_state = SPAN_NONE;
+	entryPtr->put_count  = 0;
+}
+//-------- End of function TextCache::free_entry --------//
+
+
+//--------- Begin of function TextCache::draw_profile ---------//
+//
+// Shown with the other profile information when config.show_ai_info
+// is on.
+//
+void TextCache::draw_profile()
+{
+	char str[100];
+	unsigned long useCount = hit_count + miss_count;
+
+	snprintf( str, sizeof(str), "Text cache: %lu hits, %lu misses (%lu%% hits)",
+		hit_count, miss_count, useCount ? hit_count*100/useCount : 0 );
+
+	font_news.put( ZOOM_X1+300, ZOOM_Y1+270, str );
+}
+//----------- End of function TextCache::draw_profile -----------//
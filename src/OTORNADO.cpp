@@ -27,14 +27,12 @@
 #include <OTORNADO.h>
 #include <OWORLD.h>
 #include <OWEATHER.h>
-#include <math.h>
+#include <OFIXED.h>
 #include <OFIRM.h>
 #include <OFIRMA.h>
 #include <OSERES.h>
 #include <OTOWN.h>
 
-
-#define PI 3.141592654
 #define DAMAGE_POINT_RADIUS 32
 
 #define TORNADO_SPRITE_ID  12          // Tornado sprite in SPRITE.DBF
@@ -63,9 +61,9 @@ void Tornado::init(short startX, short startY, short lifeTime)
 //----------- Begin of function Tornado::pre_process ----------//
 void Tornado::pre_process()
 {
-	double angle = misc.random(32) / 16.0 * PI;
-	dmg_offset_x = short(DAMAGE_POINT_RADIUS * sin(angle));
-	dmg_offset_y = short(DAMAGE_POINT_RADIUS * cos(angle));
+	int angle = misc.random(32) * FIXED_CIRCLE / 32;
+	dmg_offset_x = fixed_mul(DAMAGE_POINT_RADIUS, fixed_sin(angle));
+	dmg_offset_y = fixed_mul(DAMAGE_POINT_RADIUS, fixed_cos(angle));
 	if( --life_time <= 0)
 		cur_action = SPRITE_DIE;
 }
@@ -82,9 +80,9 @@ void Tornado::process_move()
 	if( speed > 10)
 		speed = 10;
 
-	double windDir = weather.wind_direct_rad() + (misc.random(31)-15)*PI/180.0;
-	cur_x += short(speed * sin(windDir));
-	cur_y -= short(speed * cos(windDir));
+	int windDir = (weather.wind_direct() + misc.random(31)-15) * FIXED_DEGREE;
+	cur_x += fixed_mul(speed, fixed_sin(windDir));
+	cur_y -= fixed_mul(speed, fixed_cos(windDir));
 	if( ++cur_frame > cur_sprite_move()->frame_count )
 		cur_frame = 1;
 	// static UCHAR nextFrame[] = { 1,6,1,1,1,1,4 };		// 1->6->4->1 ...
@@ -292,11 +290,6 @@ void TornadoArray::process()
 		if( !tornadoPtr)
 			continue;
 
-		//-------- system yield ---------//
-
-		if( i%20==1 )
-			sys.yield();
-
 		//------- process tornado --------//
 
 		tornadoPtr->pre_process();
@@ -43,6 +43,7 @@
 #include <OREMOTE.h>
 #include <OTOWN.h>
 #include <OTownNetwork.h>
+#include <ONATVIEW.h>
 #include <ONEWS.h>
 // ##### begin Gilbert 9/10 ######//
 #include <OSE.h>
@@ -140,6 +141,8 @@ void Town::init(int nationRecno, int raceId, int xLoc, int yLoc)
 
 	town_name_id = town_res.get_new_name_id(raceId);
 
+	nation_view_array.add_town(town_recno, nation_recno);
+
 	set_world_matrix();
 
 	setup_link();
@@ -184,6 +187,7 @@ void Town::deinit()
 
 	town_network_array.town_destroyed(town_recno);
 
+	nation_view_array.del_town(town_recno, nation_recno);
 
 	clear_defense_mode();
 
@@ -751,6 +755,9 @@ void Town::set_nation(int newNationRecno)
 	int oldNationRecno = nation_recno;
 	nation_recno = newNationRecno;
 
+	nation_view_array.del_town(town_recno, oldNationRecno);
+	nation_view_array.add_town(town_recno, nation_recno);
+
 	if( nation_recno )      // reset rebel_recno if the town is then ruled by a nation
 	{
 		if( rebel_recno )
@@ -51,6 +51,7 @@
 #include <OBUTTCUS.h>
 #include "gettext.h"
 #include <ConfigAdv.h>
+#include <OSPRLOAD.h>
 
 
 //------------- Define coordinations -----------//
@@ -2208,6 +2209,9 @@ void Town::add_queue(char skillId, char raceId, int amount)
 		train_queue_race_array[train_queue_count++] = raceId;
 	}	
 
+	if( enqueueAmount > 0 && raceId > 0 )		// read the unit's bitmaps before it is trained
+		sprite_loader.prefetch_unit( race_res[raceId]->basic_unit_id );
+
 	if( !train_unit_recno )
 		process_queue();
 }
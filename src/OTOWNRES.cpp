@@ -25,6 +25,7 @@
 #include <OIMGRES.h>
 #include <ORACERES.h>
 #include <OTOWNRES.h>
+#include <ORESBAKE.h>
 
 //---------- define constant ------------//
 
@@ -152,7 +153,21 @@ void TownRes::load_town_slot()
 	TownSlotRec  	*townSlotRec;
 	TownSlot     	*townSlot;
 	int      	  	i;
-	Database 		*dbTownSlot = game_set.open_db(TOWN_SLOT_DB);
+
+	//------- copy the baked records if they are up to date -------//
+
+	long bakedCount = res_bake.find_table(TOWN_SLOT_DB, sizeof(TownSlot));
+
+	if( bakedCount >= 0 )
+	{
+		town_slot_count = (short) bakedCount;
+		town_slot_array = (TownSlot*) mem_add( sizeof(TownSlot)*town_slot_count );
+
+		res_bake.copy_table(TOWN_SLOT_DB, town_slot_array);
+		return;
+	}
+
+	Database *dbTownSlot = game_set.open_db(TOWN_SLOT_DB);
 
 	town_slot_count = (short) dbTownSlot->rec_count();
 	town_slot_array = (TownSlot*) mem_add( sizeof(TownSlot)*town_slot_count );
@@ -175,6 +190,8 @@ void TownRes::load_town_slot()
 		err_when( townSlot->build_type == TOWN_OBJECT_FARM &&	
 				  (townSlot->build_code < 1 || townSlot->build_code > 9) ); 
 	}
+
+	res_bake.add_table(TOWN_SLOT_DB, dbTownSlot, town_slot_array, sizeof(TownSlot));
 }
 //--------- End of function TownRes::load_town_slot ---------//
 
@@ -260,9 +277,19 @@ void TownRes::load_town_name()
 	TownNameRec *townNameRec;
 	TownName		*townName;
 	int      	i;
-	Database 	*dbTownName = game_set.open_db(TOWN_NAME_DB);
+	Database 	*dbTownName = NULL;
+	long			bakedCount = res_bake.find_table(TOWN_NAME_DB, sizeof(TownName));
+
+	if( bakedCount < 0 )		// the baked records are not up to date
+	{
+		dbTownName = game_set.open_db(TOWN_NAME_DB);
+		town_name_count = dbTownName->rec_count();
+	}
+	else
+	{
+		town_name_count = bakedCount;
+	}
 
-	town_name_count 		= dbTownName->rec_count();
 	town_name_array		= (TownName*) mem_add( sizeof(TownName)*town_name_count );
 	town_name_used_array = (unsigned char*) mem_add( sizeof(town_name_used_array[0]) * town_name_count );		// store the used_count separately from town_name_array to faciliate file saving
 
@@ -270,14 +297,30 @@ void TownRes::load_town_name()
 
 	//------ read in TownName info array -------//
 
+	if( !dbTownName )
+	{
+		res_bake.copy_table(TOWN_NAME_DB, town_name_array);
+	}
+	else
+	{
+		for( i=1 ; i<=town_name_count ; i++ )
+		{
+			townNameRec = (TownNameRec*) dbTownName->read(i);
+			townName    = town_name_array+i-1;
+
+			misc.rtrim_fld( townName->name, townNameRec->name, townNameRec->NAME_LEN );
+		}
+
+		res_bake.add_table(TOWN_NAME_DB, dbTownName, town_name_array, sizeof(TownName));
+	}
+
+	//------ get the town names of each race -------//
+
 	int raceId=0;
 
 	for( i=1 ; i<=town_name_count ; i++ )
 	{
-		townNameRec = (TownNameRec*) dbTownName->read(i);
-		townName    = town_name_array+i-1;
-
-		misc.rtrim_fld( townName->name, townNameRec->name, townNameRec->NAME_LEN );
+		townName = town_name_array+i-1;
 
 		if( townName->name[0]=='@' )		// next race
 		{
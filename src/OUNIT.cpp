@@ -31,6 +31,8 @@
 #include <ONATION.h>
 #include <OGAME.h>
 #include <OTOWN.h>
+#include <ONATVIEW.h>
+#include <ORENDSNP.h>
 #include <ORACERES.h>
 #include <OPOWER.h>
 #include <OU_VEHI.h>
@@ -299,6 +301,10 @@ void Unit::init_unit_id(int unitId)
 
 	if( unit_res[unit_id]->unit_class == UNIT_CLASS_MONSTER )
 		unit_res.mobile_monster_count++;
+
+	//------- add to the nation's report view -------//
+
+	nation_view_array.add_unit(sprite_recno, nation_recno, unit_id, rank_id);
 }
 //----------- End of function Unit::init_unit_id -----------//
 
@@ -314,6 +320,8 @@ void Unit::deinit_unit_id()
 
    UnitInfo *unitInfo = unit_res[unit_id];
 
+   nation_view_array.del_unit(sprite_recno, nation_recno, unit_id, rank_id);
+
    if( nation_recno )
    {
       if( rank_id != RANK_KING )
@@ -434,6 +442,8 @@ void Unit::deinit()
    if( !unit_id )
       return;
 
+   render_snapshot.del_unit(sprite_recno);		// the recno may be given to a new unit
+
    //-------- if this is a king --------//
 
    if( !sys.signal_exit_flag && nation_recno )
@@ -1557,9 +1567,13 @@ void Unit::change_nation(int newNationRecno)
 
 	//---------------- update vars ----------------//
 
+	nation_view_array.del_unit(sprite_recno, nation_recno, unit_id, rank_id);
+
 	unit_group_id = unit_array.cur_group_id++;      // separate from the current group
 	nation_recno  = newNationRecno;
 
+	nation_view_array.add_unit(sprite_recno, nation_recno, unit_id, rank_id);
+
 	home_camp_firm_recno  = 0;					// reset it
 	original_action_mode  = 0;
 
@@ -1932,6 +1946,11 @@ void Unit::set_rank(int rankId)
 			unitInfo->dec_nation_unit_count(nation_recno);     // since kings are not included in nation_unit_count, we need to decrease it
 	}
 
+	//------ update the nation's report view ------//
+
+	nation_view_array.del_unit(sprite_recno, nation_recno, unit_id, rank_id);
+	nation_view_array.add_unit(sprite_recno, nation_recno, unit_id, rankId);
+
 	//----- reset leader_unit_recno if demote a general to soldier ----//
 
 	if( rank_id == RANK_GENERAL && rankId == RANK_SOLDIER )
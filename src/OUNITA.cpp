@@ -537,7 +537,6 @@ static void put_profile(int y, const char* dispDes, int dispValue)
 //
 void UnitArray::process()
 {
-	#define SYS_YIELD_INTERVAL	50
 	#define YEAR_FRAME_COUNT	365*FRAMES_PER_DAY // choose a value that is multiply of FRAMES_PER_DAY
 	Unit* unitPtr;
 	int i;
@@ -548,18 +547,9 @@ void UnitArray::process()
 	int compareI = arraySize%FRAMES_PER_DAY;
 	if(compareI < sysFrameCount)
 		compareI += FRAMES_PER_DAY;
-	int sysYieldCount = arraySize - arraySize%SYS_YIELD_INTERVAL;
 
 	for(i=arraySize; i; --i, compareI--) // for(i=arraySize; i>0; --i, compareI++) or //for(i=1; i<=arraySize; i++, compareI++)
 	{
-		//-------- system yield ---------//
-		if(i==sysYieldCount)
-		{
-			sysYieldCount -= SYS_YIELD_INTERVAL;
-			sys.yield();
-		}
-
-		//-------------------------------//
 		if(compareI == sysFrameCount)
 		{
 			compareI += FRAMES_PER_DAY;
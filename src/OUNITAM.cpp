@@ -30,6 +30,7 @@
 #include <OWORLD.h>
 #include <OTERRAIN.h>
 #include <OUNIT.h>
+#include <OFLOWFLD.h>
 #include <dbglog.h>
 
 DBGLOG_DEFAULT_CHANNEL(Unit);
@@ -519,6 +520,15 @@ void UnitArray::move_to_now(int destXLoc, int destYLoc, short* selectedUnitArray
 		construct_sorted_array(selectedSizeOneUnitArray, sizeOneSelectedCount);	// distance and sorted_member should be initialized first
 		err_when(x<0 || y<0 || x>=MAX_WORLD_X_LOC || y>=MAX_WORLD_Y_LOC);
 
+		//---- large land groups share a flow field instead of reusing the leader's path ----//
+		int useFlowField = mobileType==UNIT_LAND && sizeOneSelectedCount>=MIN_FLOW_FIELD_UNIT_COUNT;
+
+		if(useFlowField)
+		{
+			unitPtr = (Unit*) get_ptr(selectedSizeOneUnitArray[0]);
+			flow_field_array.add_group(curGroupId, destX, destY, MAX(rec_width, rec_height)+move_scale, unitPtr->nation_recno);
+		}
+
 		//------------ process the movement -----------//
 		unprocessCount = sizeOneSelectedCount;//selectedCount;
 		k=0;
@@ -543,7 +553,7 @@ void UnitArray::move_to_now(int destXLoc, int destYLoc, short* selectedUnitArray
 						}while(unitPtr->sprite_info->loc_width>1);
 						
 						err_when(k>sizeOneSelectedCount);
-						if(sizeOneSelectedCount>1)
+						if(sizeOneSelectedCount>1 && !useFlowField)
 						{
 							if(unprocessCount==sizeOneSelectedCount) // the first unit to move
 							{	
@@ -591,7 +601,7 @@ void UnitArray::move_to_now(int destXLoc, int destYLoc, short* selectedUnitArray
 						}while(unitPtr->sprite_info->loc_width>1);
 						err_when(k>sizeOneSelectedCount);
 
-						if(sizeOneSelectedCount>1)
+						if(sizeOneSelectedCount>1 && !useFlowField)
 						{
 							if(unprocessCount==sizeOneSelectedCount) // the first unit to move
 							{
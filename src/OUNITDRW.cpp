@@ -58,7 +58,8 @@ void Unit::draw(const int outlined)
 	SpriteFrame* spriteFrame = cur_sprite_frame(&needMirror);
 	update_abs_pos(spriteFrame);
 
-	err_when(!sprite_info->res_bitmap.initialized()); 
+	if( !sprite_info->is_bitmap_ready() )		// still being read by sprite_loader
+		return;
 
 	char* bitmapPtr = sprite_info->res_bitmap.read_imported(spriteFrame->bitmap_offset);
 
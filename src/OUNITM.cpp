@@ -30,6 +30,8 @@
 #include <OU_MARI.h>
 #include <OSPATH.h>
 #include <OSPREUSE.h>
+#include <OSPATHC.h>
+#include <OFLOWFLD.h>
 #include <OSERES.h>
 #include <OLOG.h>
 #include <OEFFECT.h>
@@ -55,6 +57,10 @@
 #endif
 //-*********** simulate aat ************-//
 
+//--------- Define constant ------------//
+
+#define MAX_REACHABLE_LOCATE_RANGE	30		// how far to look for a reachable location near an unreachable destination
+
 //--- Define no. of pixels per direction move (N, NE, E, SE, S, SW, W, NW) ---//
 
 static short move_x_pixel_array[] = { 0, ZOOM_LOC_WIDTH, ZOOM_LOC_WIDTH, ZOOM_LOC_WIDTH, 0, -ZOOM_LOC_WIDTH, -ZOOM_LOC_WIDTH, -ZOOM_LOC_WIDTH };
@@ -707,6 +713,48 @@ void Unit::select_search_sub_mode(int sx, int sy, int dx, int dy, short nationRe
 //----------- End of function Unit::select_search_sub_mode -----------//
 
 
+//------- Begin of static function is_dest_unreachable ---------//
+//
+// Return whether the connected areas of the map tell that the
+// destination of the search cannot be reached. Searches which do not
+// need to end next to the destination, such as attacking by range, are
+// not checked.
+//
+static int is_dest_unreachable(int startXLoc, int startYLoc, int destXLoc, int destYLoc, char mobileType, short searchMode, short miscNo)
+{
+	int destXLoc2 = destXLoc, destYLoc2 = destYLoc;
+
+	switch(searchMode)
+	{
+		case SEARCH_MODE_IN_A_GROUP:
+		case SEARCH_MODE_A_UNIT_IN_GROUP:
+		case SEARCH_MODE_TO_ATTACK:
+		case SEARCH_MODE_REUSE:
+		case SEARCH_MODE_BLOCKING:
+		case SEARCH_MODE_TO_WALL_FOR_GROUP:
+		case SEARCH_MODE_TO_WALL_FOR_UNIT:
+				break;
+
+		case SEARCH_MODE_TO_FIRM:
+				destXLoc2 = destXLoc + firm_res[miscNo]->loc_width - 1;
+				destYLoc2 = destYLoc + firm_res[miscNo]->loc_height - 1;
+				break;
+
+		case SEARCH_MODE_TO_TOWN:
+				destXLoc2 = destXLoc + STD_TOWN_LOC_WIDTH - 1;
+				destYLoc2 = destYLoc + STD_TOWN_LOC_HEIGHT - 1;
+				break;
+
+		default:		// to vehicle, attacking by range and ship to land
+				return 0;
+	}
+
+	return !world.can_reach(startXLoc, startYLoc, startXLoc, startYLoc, destXLoc, destYLoc,
+									MIN(destXLoc2, MAX_WORLD_X_LOC-1), MIN(destYLoc2, MAX_WORLD_Y_LOC-1), mobileType);
+}
+//-------- End of static function is_dest_unreachable ---------//
+
+
 //--------- Begin of function Unit::searching ---------//
 int Unit::searching(int destXLoc, int destYLoc, int preserveAction, short searchMode, short miscNo, short numOfPath, short reuseMode, short pathReuseStatus)
 {
@@ -739,6 +787,31 @@ int Unit::searching(int destXLoc, int destYLoc, int preserveAction, short search
 		move_to_y_loc = destYLoc;
 	//}
 
+	//------------------------------------------------------------//
+	// check whether the destination can be reached at all, before
+	// using up all the nodes on seeking a path to it. AI units
+	// count it as a failed search. Other units go to the closest
+	// location they can reach, as seek() would have returned.
+	//------------------------------------------------------------//
+	int unreachableFlag = 0;
+
+	if( (searchMode!=SEARCH_MODE_REUSE || numOfPath==1) &&
+		 is_dest_unreachable(startXLocLoc, startYLocLoc, destXLoc, destYLoc, mobile_type, searchMode, miscNo) )
+	{
+		if( ai_unit )
+		{
+			unreachableFlag = 1;
+		}
+		else if( mobile_type==UNIT_LAND &&
+					world.locate_reachable(destXLoc, destYLoc, startXLocLoc, startYLocLoc, MAX_REACHABLE_LOCATE_RANGE) )
+		{
+			move_to_x_loc = destXLoc;
+			move_to_y_loc = destYLoc;
+			searchMode = SEARCH_MODE_IN_A_GROUP;
+			miscNo = 0;
+		}
+	}
+
 	//------------------------------------------------------------//
 	// fast checking for destination == current location
 	//------------------------------------------------------------//
@@ -773,20 +846,59 @@ int Unit::searching(int destXLoc, int destYLoc, int preserveAction, short search
 	seek_path.set_nation_recno(nation_recno);
 
 	int seekResult;
+	FlowField* flowField = NULL;
+
+	if( !unreachableFlag && searchMode==SEARCH_MODE_IN_A_GROUP && mobile_type==UNIT_LAND &&
+		 (flowField = flow_field_array.get_field(unit_group_id, destXLoc, destYLoc)) &&
+		 !flowField->can_use(startXLocLoc, startYLocLoc, destXLoc, destYLoc) )
+	{
+		flowField = NULL;
+	}
+
 	#ifdef DEBUG
 		unsigned long seekPathStartTime = misc.get_time();
 	#endif
 	/*switch(sprite_info->loc_width)
 	{
 		case 1:*/
-					if(searchMode!=SEARCH_MODE_REUSE || numOfPath==1)	// no need to call path_reuse
+					if(unreachableFlag)
+					{
+						seekResult = PATH_NODE_USED_UP;		// no path is sought
+					}
+					else if(flowField)	// a large group move sharing a flow field
+					{
+						select_search_sub_mode(startXLocLoc, startYLocLoc, destXLoc, destYLoc, nation_recno, searchMode);
+						result_node_array = flowField->get_path(startXLocLoc, startYLocLoc, destXLoc, destYLoc, unit_group_id,
+																			 result_node_count, result_path_dist);
+						seek_path.set_sub_mode(); // reset sub_mode searching
+						seekResult = PATH_FOUND;
+					}
+					else if(searchMode!=SEARCH_MODE_REUSE || numOfPath==1)	// no need to call path_reuse
 					{
 						if(mobile_type==UNIT_LAND)
 							select_search_sub_mode(startXLocLoc, startYLocLoc, destXLoc, destYLoc, nation_recno, searchMode);
-						seekResult = seek_path.seek(startXLocLoc, startYLocLoc, destXLoc, destYLoc, unit_group_id,
-															mobile_type, searchMode, miscNo, numOfPath, unit_search_tries);
 
-						result_node_array = seek_path.get_result(result_node_count, result_path_dist);
+						int canCache = SeekPathCache::can_cache(mobile_type, searchMode, numOfPath);
+
+						if( canCache &&
+							 (result_node_array = seek_path_cache.get_path(startXLocLoc, startYLocLoc, destXLoc, destYLoc, mobile_type,
+														searchMode, miscNo, nation_recno, result_node_count, result_path_dist)) )
+						{
+							seekResult = PATH_FOUND;
+						}
+						else
+						{
+							seekResult = seek_path.seek(startXLocLoc, startYLocLoc, destXLoc, destYLoc, unit_group_id,
+																mobile_type, searchMode, miscNo, numOfPath, unit_search_tries);
+
+							result_node_array = seek_path.get_result(result_node_count, result_path_dist);
+
+							if( canCache && seekResult==PATH_FOUND )
+							{
+								seek_path_cache.add_path(startXLocLoc, startYLocLoc, destXLoc, destYLoc, mobile_type,
+																 searchMode, miscNo, nation_recno, result_node_array, result_node_count, result_path_dist);
+							}
+						}
 						seek_path.set_sub_mode(); // reset sub_mode searching
 					}
 					else	// use path_reuse
@@ -821,7 +933,7 @@ int Unit::searching(int destXLoc, int destYLoc, int preserveAction, short search
 	{
 		//----- set seek_path_fail_count ------//
 
-		if( seekResult==PATH_IMPOSSIBLE ||
+		if( seekResult==PATH_IMPOSSIBLE || unreachableFlag ||
 			 (seekResult==PATH_NODE_USED_UP &&    // if all the nodes have been used up and the number of nodes original available is >= VALID_BACKGROUND_SEARCH_NODE
 			  totalAvailableNode >= VALID_BACKGROUND_SEARCH_NODE) )
 		{
@@ -27,6 +27,7 @@
 #include <ALL.h>
 #include <math.h>
 #include <OWORLDMT.h>
+#include <OFIXED.h>
 #include <stdlib.h>
 
 //---------- Define constant -----------//
@@ -65,9 +66,8 @@ void Weather::init_date(short year, short month, short day, short latitude, int
 	day_to_quake = quakeFreq + rand_seed(quakeFreq);
 
 	// ----------- determine avg_temp and temp_amp from latitude
-	double angle = latitude * PI / 180.0;
 	avg_temp = (short)( 35.0 - fabs(latitude / 90.0 * 40.0));
-	temp_amp = (short)( 17.0 * sin(angle));	// negative for South Hemisphere
+	temp_amp = (short) fixed_mul( 17, fixed_sin(latitude * FIXED_DEGREE) );	// negative for South Hemisphere
 
 	// ----------- determine cloud ----------- //
 	cur_cloud_str = rand_seed(4);
@@ -201,8 +201,9 @@ void Weather::next_day()
 //
 short Weather::base_temp()
 {
-	return( (short)(avg_temp + temp_amp * sin(season_phase / 365.0
-		* 2 * PI) ));
+	int seasonSin = fixed_sin(season_phase * FIXED_CIRCLE / 365);
+
+	return (short) ( ((int64_t) avg_temp * FIXED_ONE + (int64_t) temp_amp * seasonSin) / FIXED_ONE );
 }
 //---------- End of function Weather::base_temp ----------//
 
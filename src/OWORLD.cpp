@@ -39,6 +39,8 @@
 #include <OWEATHER.h>
 #include <OTERRAIN.h>
 #include <OWORLD.h>
+#include <OFLOWFLD.h>
+#include <OSPATHC.h>
 #include <OANLINE.h>
 #include <OTORNADO.h>
 #include <OU_VEHI.h>
@@ -64,6 +66,10 @@ World::World()
 	lightning_signal = 0;
 	plant_count = 0;
 	plant_limit = 0;
+	unit_block_count = NULL;
+	unit_block_width = 0;
+	pass_change_count = 0;
+	power_change_count = 0;
 
    //------- initialize matrix objects -------//
 
@@ -119,6 +125,20 @@ void World::deinit()
       mem_del( loc_matrix );
       loc_matrix  = NULL;
    }
+
+	if( unit_block_count )
+	{
+		mem_del( unit_block_count );
+		unit_block_count = NULL;
+	}
+
+	pass_map.deinit();
+	occupy_map.deinit();
+	build_map.deinit();
+	reach_map.deinit();
+
+	flow_field_array.deinit();
+	seek_path_cache.deinit();
 }
 //------------- End of function World::deinit -----------//
 
@@ -135,6 +155,11 @@ void World::assign_map()
    map_matrix-> assign_map(loc_matrix, max_x_loc, max_y_loc );
 	zoom_matrix->assign_map(loc_matrix, max_x_loc, max_y_loc );
 
+	map_matrix->clear_terrain_layer();		// the terrain may still be changed by the map generator
+
+	count_block_units();
+	build_pass_maps();
+
    //-------- set the zoom area box on map matrix ------//
 
    map_matrix->cur_x_loc = 0;
@@ -145,6 +170,57 @@ void World::assign_map()
 //----------- End of function World::assign_map ----------//
 
 
+//--------- Begin of function World::count_block_units ----------//
+//
+// Count the units already on the map into unit_block_count. After
+// this, set_unit_recno() keeps the counts up to date.
+//
+void World::count_block_units()
+{
+	unit_block_width = (max_x_loc+UNIT_BLOCK_SIZE-1) >> UNIT_BLOCK_SHIFT;
+
+	int blockCount = unit_block_width * ((max_y_loc+UNIT_BLOCK_SIZE-1) >> UNIT_BLOCK_SHIFT);
+
+	unit_block_count = (short*) mem_resize( unit_block_count, blockCount * sizeof(short) );
+	memset( unit_block_count, 0, blockCount * sizeof(short) );
+
+	Location* locPtr = loc_matrix;
+
+	for( int yLoc=0 ; yLoc<max_y_loc ; yLoc++ )
+	{
+		for( int xLoc=0 ; xLoc<max_x_loc ; xLoc++, locPtr++ )
+		{
+			if( locPtr->cargo_recno && !(locPtr->loc_flag & LOCATE_BLOCK_MASK) )		// a unit, see Location
+				unit_block_count[(yLoc>>UNIT_BLOCK_SHIFT)*unit_block_width + (xLoc>>UNIT_BLOCK_SHIFT)]++;
+		}
+	}
+}
+//----------- End of function World::count_block_units ----------//
+
+
+//--------- Begin of function World::area_unit_count ----------//
+//
+// Return the no. of land and sea units in the unit blocks overlapping
+// the given area. It may include units just outside the area, so a
+// zero means there is surely no unit in it.
+//
+int World::area_unit_count(int xLoc1, int yLoc1, int xLoc2, int yLoc2)
+{
+	int unitCount = 0;
+
+	for( int yBlock=yLoc1>>UNIT_BLOCK_SHIFT ; yBlock<=yLoc2>>UNIT_BLOCK_SHIFT ; yBlock++ )
+	{
+		short* countPtr = unit_block_count + yBlock*unit_block_width;
+
+		for( int xBlock=xLoc1>>UNIT_BLOCK_SHIFT ; xBlock<=xLoc2>>UNIT_BLOCK_SHIFT ; xBlock++ )
+			unitCount += countPtr[xBlock];
+	}
+
+	return unitCount;
+}
+//----------- End of function World::area_unit_count ----------//
+
+
 //----------- Begin of function World::paint ------------//
 //
 // Paint world window and scroll bars
@@ -489,13 +565,6 @@ void World::explore(int xLoc1, int yLoc1, int xLoc2, int yLoc2)
 	int 		 xLoc, yLoc;
 	Location* locPtr;
 	char* 	 imageBuf = map_matrix->save_image_buf + sizeof(short)*2;
-	char*     nationColorArray = nation_array.nation_power_color_array;
-	char* 	 writePtr;
-
-	int		shadowMapDist = max_x_loc + 1;
-	int		tileYOffset;
-	Location	*northWestPtr;
-	char		tilePixel;
 
 	for( yLoc=yLoc1 ; yLoc<=yLoc2 ; yLoc++ )
 	{
@@ -509,72 +578,7 @@ void World::explore(int xLoc1, int yLoc1, int xLoc2, int yLoc2)
 
 				//-------- draw pixel ----------//
 
-				writePtr = imageBuf+MAP_WIDTH*yLoc+xLoc;
-
-				switch( world.map_matrix->map_mode )
-				{
-					case MAP_MODE_TERRAIN:
-						if( locPtr->fire_str() > 0)
-							*writePtr = (char) FIRE_COLOR;
-
-						else if( locPtr->is_plant() )
-							*writePtr = plant_res.plant_map_color;
-
-						else
-						{
-							tileYOffset = (yLoc & TERRAIN_TILE_Y_MASK) * TERRAIN_TILE_WIDTH;
-
-							tilePixel = terrain_res.get_map_tile(locPtr->terrain_id)[tileYOffset + (xLoc & TERRAIN_TILE_X_MASK)];
-
-							if( xLoc == 0 || yLoc == 0)
-							{
-								*writePtr = tilePixel;
-							}
-							else
-							{
-								northWestPtr = locPtr - shadowMapDist;
-								if( (terrain_res[locPtr->terrain_id]->average_type >=
-									terrain_res[northWestPtr->terrain_id]->average_type) )
-								{
-									*writePtr = tilePixel;
-								}
-								else
-								{
-									*writePtr = (char) VGA_GRAY;
-								}
-							}
-							break;
-						}
-						break;
-
-					case MAP_MODE_SPOT:
-						if( locPtr->sailable() )
-							*writePtr = (char) 0x32;
-
-						else if( locPtr->has_hill() )
-							*writePtr = (char) V_BROWN;
-
-						else if( locPtr->is_plant() )
-							*writePtr = (char) V_DARK_GREEN;
-
-						else
-							*writePtr = (char) VGA_GRAY+10;
-						break;
-
-					case MAP_MODE_POWER:
-						if( locPtr->sailable() )
-							*writePtr = (char) 0x32;
-
-						else if( locPtr->has_hill() )
-							*writePtr = (char) V_BROWN;
-
-						else if( locPtr->is_plant() )
-							*writePtr = (char) V_DARK_GREEN;
-
-						else
-							*writePtr = nationColorArray[locPtr->power_nation_recno];
-						break;
-				}
+				imageBuf[MAP_WIDTH*yLoc+xLoc] = map_matrix->get_loc_color(xLoc, yLoc);
 
 				//---- if the command base of the opponent revealed, establish contact ----//
 
@@ -758,18 +762,15 @@ inline int World::check_unit_space(int xLoc1, int yLoc1, int xLoc2, int yLoc2, i
 	if(yLoc2<0 || yLoc2>=MAX_WORLD_Y_LOC)
 		return 0;
 
-	Location* locPtr = world.get_loc(xLoc1, yLoc1);
 	int x, y;
 	int canBuildFlag = 1;
 
 	for(y=yLoc1; y<=yLoc2; y++)
 	{
-		locPtr = world.get_loc(xLoc1, y);
-
-		for(x=xLoc1; x<=xLoc2; x++, locPtr++)
+		for(x=xLoc1; x<=xLoc2; x++)
 		{
-			if( !locPtr->can_move(mobileType) ||
-				 ( buildFlag && (locPtr->is_power_off() || locPtr->has_site()) ) ) 		// if build a firm/town, there must not be any sites in the area
+			if( !can_move(x, y, mobileType) ||
+				 ( buildFlag && (build_map.get(MAX_WORLD_X_LOC*y+x) != (BUILD_NO_SITE | BUILD_POWER_ON)) ) ) 		// if build a firm/town, there must not be any sites in the area
 			{
 				canBuildFlag=0;
 				break;
@@ -1136,7 +1137,7 @@ int World::can_build_firm(int xLoc1, int yLoc1, int firmId, short unitRecno)
 	int xLoc, yLoc;
 	int xLoc2 = xLoc1 + firmInfo->loc_width - 1;
 	int yLoc2 = yLoc1 + firmInfo->loc_height - 1;
-	if(xLoc2>=max_x_loc || yLoc2>max_y_loc)
+	if(xLoc2>=max_x_loc || yLoc2>=max_y_loc)
 		return 0;
 
 	Location* locPtr;
@@ -1150,17 +1151,15 @@ int World::can_build_firm(int xLoc1, int yLoc1, int firmId, short unitRecno)
 		teraMask = firmInfo->tera_type;
 		for( yLoc=yLoc1 ; yLoc<=yLoc2 ; yLoc++ )
 		{
-			locPtr = get_loc(xLoc1, yLoc);
-
-			for( xLoc=xLoc1 ; xLoc<=xLoc2 ; xLoc++, locPtr++ )
+			for( xLoc=xLoc1 ; xLoc<=xLoc2 ; xLoc++ )
 			{
 				// ##### patch begin Gilbert 14/3 ######//
-				if(!locPtr->can_build_firm(teraMask) && 
-					(!locPtr->has_unit(UNIT_LAND) || locPtr->unit_recno(UNIT_LAND)!=unitRecno))
+				if(!can_build(xLoc, yLoc, teraMask) &&
+					(!(locPtr=get_loc(xLoc, yLoc))->has_unit(UNIT_LAND) || locPtr->unit_recno(UNIT_LAND)!=unitRecno))
 					return 0;
 				// ##### patch end Gilbert 14/3 ######//
 
-				if( firmId != FIRM_MINE && locPtr->has_site() )		// don't allow building any buildings other than mines on a location with a site
+				if( firmId != FIRM_MINE && !(build_map.get(MAX_WORLD_X_LOC*yLoc+xLoc) & BUILD_NO_SITE) )		// don't allow building any buildings other than mines on a location with a site
 					return 0;
 			}
 		}
@@ -1178,26 +1177,29 @@ int World::can_build_firm(int xLoc1, int yLoc1, int firmId, short unitRecno)
 		pierFlag = 1|2|4|8;		// bit0=north, bit1=south, bit2=west, bit3=east
 		for( yLoc=yLoc1 ; yLoc<=yLoc2 ; yLoc++ )
 		{
-			locPtr = get_loc(xLoc1, yLoc);
-
-			for( xLoc=xLoc1 ; xLoc<=xLoc2 ; xLoc++, locPtr++ )
+			for( xLoc=xLoc1 ; xLoc<=xLoc2 ; xLoc++ )
 			{
-				if( locPtr->has_site() )		// don't allow building any buildings other than mines on a location with a site
+				int locOffset = MAX_WORLD_X_LOC*yLoc + xLoc;
+
+				if( !(build_map.get(locOffset) & BUILD_NO_SITE) )		// don't allow building any buildings other than mines on a location with a site
 					return 0;
 
+				// same as Location::can_build_harbor()
+				int harborTera = (occupy_map.get(locOffset) & OCCUPY_GROUND) ? 0 : pass_map.get(locOffset);
+
 static char northPierTera[3][3] = { {2,2,2},{2,2,2},{3,1,3} };
 static char southPierTera[3][3] = { {3,1,3},{2,2,2},{2,2,2} };
 static char westPierTera[3][3] = { {2,2,3},{2,2,1},{2,2,3} };
 static char eastPierTera[3][3] = { {3,2,2},{1,2,2},{3,2,2} };
 				int x = xLoc - xLoc1;
 				int y = yLoc - yLoc1;
-				if(!locPtr->can_build_harbor(northPierTera[y][x]) )
+				if(!(harborTera & northPierTera[y][x]))
 					pierFlag &= ~1;
-				if(!locPtr->can_build_harbor(southPierTera[y][x]) )
+				if(!(harborTera & southPierTera[y][x]))
 					pierFlag &= ~2;
-				if(!locPtr->can_build_harbor(westPierTera[y][x]) )
+				if(!(harborTera & westPierTera[y][x]))
 					pierFlag &= ~4;
-				if(!locPtr->can_build_harbor(eastPierTera[y][x]) )
+				if(!(harborTera & eastPierTera[y][x]))
 					pierFlag &= ~8;
 			}
 		}
@@ -1236,14 +1238,12 @@ int World::can_build_town(int xLoc1, int yLoc1, short unitRecno)
 
 	for( yLoc=yLoc1 ; yLoc<=yLoc2 ; yLoc++ )
 	{
-		locPtr = get_loc(xLoc1, yLoc);
-
-		for( xLoc=xLoc1 ; xLoc<=xLoc2 ; xLoc++, locPtr++ )
+		for( xLoc=xLoc1 ; xLoc<=xLoc2 ; xLoc++ )
 		{
 			// ##### patch begin Gilbert 14/3 ######//
 			// allow the building unit to stand in the area
-			if( !locPtr->can_build_town() && 
-				(!locPtr->has_unit(UNIT_LAND) || locPtr->unit_recno(UNIT_LAND)!=unitRecno) )
+			if( !(can_build(xLoc, yLoc, PASS_LAND) && (build_map.get(MAX_WORLD_X_LOC*yLoc+xLoc) & BUILD_NO_SITE)) &&
+				(!(locPtr=get_loc(xLoc, yLoc))->has_unit(UNIT_LAND) || locPtr->unit_recno(UNIT_LAND)!=unitRecno) )
 				return 0;
 			// ##### patch end Gilbert 14/3 ######//
 		}
@@ -1538,6 +1538,7 @@ void World::set_power(int xLoc1, int yLoc1, int xLoc2, int yLoc2, int nationRecn
 			if(locPtr->power_nation_recno==0)
 			{
 				locPtr->power_nation_recno = nationRecno;
+				power_change_count++;
 				sys.map_need_redraw = 1;						// request redrawing the map next time
 			}
 		}
@@ -1592,6 +1593,7 @@ void World::restore_power(int xLoc1, int yLoc1, int xLoc2, int yLoc2, int townRe
 			if( locPtr->power_nation_recno==nationRecno )
 			{
 				locPtr->power_nation_recno = 0;
+				power_change_count++;
 				sys.map_need_redraw = 1;						// request redrawing the map next time
 			}
 		}
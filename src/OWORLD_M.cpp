@@ -23,6 +23,7 @@
 
 #include "ambition/7kaaInterface/draw.hh"
 
+#include <ALL.h>
 #include <OMOUSE.h>
 #include <OIMGRES.h>
 #include <OPLANT.h>
@@ -36,6 +37,9 @@
 
 MapMatrix::MapMatrix()
 {
+	terrain_layer = NULL;
+	terrain_layer_valid = 0;
+
 	init( MAP_X1, MAP_Y1, MAP_X2, MAP_Y2,
 			MAP_WIDTH, MAP_HEIGHT,
 			MAP_LOC_WIDTH, MAP_LOC_HEIGHT, 1 );    // 1-create a background buffer
@@ -47,6 +51,8 @@ MapMatrix::MapMatrix()
 
 MapMatrix::~MapMatrix()
 {
+	if( terrain_layer )
+		mem_del(terrain_layer);
 }
 //---------- End of function MapMatrix::~MapMatrix ----------//
 
@@ -168,21 +174,18 @@ void MapMatrix::draw_map()
 
 	//----------- draw map now ------------//
 
-	sys.yield();
+	if( !terrain_layer_valid )
+		build_terrain_layer();
 
-	int		 shadowMapDist = max_x_loc + 1;
-	int		 tileYOffset;
-	char		 tilePixel;
-	Location* northWestPtr;
+	const char* layerPtr = terrain_layer;
+	const char  plantColor = plant_res.plant_map_color;
 
 	switch(map_mode)
 	{
 	case MAP_MODE_TERRAIN:
 		for( y=image_y1 ; y<=image_y2 ; y++, writePtr+=lineRemain )
 		{
-			tileYOffset = (y & TERRAIN_TILE_Y_MASK) * TERRAIN_TILE_WIDTH;
-
-			for( x=image_x1 ; x<=image_x2 ; x++, writePtr++, locPtr++ )
+			for( x=image_x1 ; x<=image_x2 ; x++, writePtr++, locPtr++, layerPtr++ )
 			{
 				if( locPtr->explored() )
 				{
@@ -190,31 +193,10 @@ void MapMatrix::draw_map()
 						*writePtr = (char) FIRE_COLOR;
 
 					else if( locPtr->is_plant() )
-						*writePtr = plant_res.plant_map_color;
+						*writePtr = plantColor;
 
 					else
-					{
-						tilePixel = terrain_res.get_map_tile(locPtr->terrain_id)[tileYOffset + (x & TERRAIN_TILE_X_MASK)];
-
-						if( y == image_y1 || x == image_x1)
-						{
-							*writePtr = tilePixel;
-						}
-						else
-						{
-							northWestPtr = locPtr - shadowMapDist;
-
-							if( terrain_res[locPtr->terrain_id]->average_type >=
-								terrain_res[northWestPtr->terrain_id]->average_type)
-							{
-								*writePtr = tilePixel;
-							}
-							else
-							{
-								*writePtr = (char) VGA_GRAY;
-							}
-						}
-					}
+						*writePtr = *layerPtr;
 				}
 				else
 				{
@@ -268,7 +250,7 @@ void MapMatrix::draw_map()
 						*writePtr = (char) V_DARK_GREEN;
 
 					else
-						*writePtr = nationColorArray[locPtr->power_nation_recno];
+						*writePtr = nationColorArray[(unsigned char) locPtr->power_nation_recno];
 				}
 				else
 				{
@@ -278,12 +260,104 @@ void MapMatrix::draw_map()
 		}
 		break;
 	}
-
-	sys.yield();
 }
 //------------ End of function MapMatrix::draw_map ------------//
 
 
+//------- Begin of function MapMatrix::build_terrain_layer ---------//
+//
+// Build the terrain colours of the terrain map mode, shaded grey where the
+// north-west neighbour is of a higher terrain type. The tiles are aligned
+// to the screen position of the map, as they have always been drawn.
+//
+void MapMatrix::build_terrain_layer()
+{
+	terrain_layer = mem_resize(terrain_layer, max_x_loc * max_y_loc);
+
+	Location* locPtr = loc_matrix;
+	char*		 layerPtr = terrain_layer;
+	int		 shadowMapDist = max_x_loc + 1;
+
+	for( int yLoc=0 ; yLoc<max_y_loc ; yLoc++ )
+	{
+		int tileYOffset = ((image_y1+yLoc) & TERRAIN_TILE_Y_MASK) * TERRAIN_TILE_WIDTH;
+
+		for( int xLoc=0 ; xLoc<max_x_loc ; xLoc++, locPtr++, layerPtr++ )
+		{
+			char tilePixel = terrain_res.get_map_tile(locPtr->terrain_id)[tileYOffset + ((image_x1+xLoc) & TERRAIN_TILE_X_MASK)];
+
+			if( xLoc == 0 || yLoc == 0 ||
+				 terrain_res[locPtr->terrain_id]->average_type >=
+				 terrain_res[(locPtr-shadowMapDist)->terrain_id]->average_type )
+			{
+				*layerPtr = tilePixel;
+			}
+			else
+			{
+				*layerPtr = (char) VGA_GRAY;
+			}
+		}
+	}
+
+	terrain_layer_valid = 1;
+}
+//------- End of function MapMatrix::build_terrain_layer ---------//
+
+
+//------- Begin of function MapMatrix::get_loc_color ---------//
+//
+// Return the colour of a single location in the current map mode,
+// the same as draw_map() would draw it.
+//
+char MapMatrix::get_loc_color(int xLoc, int yLoc)
+{
+	Location* locPtr = get_loc(xLoc, yLoc);
+
+	if( !locPtr->explored() )
+		return UNEXPLORED_COLOR;
+
+	switch(map_mode)
+	{
+	case MAP_MODE_TERRAIN:
+		if( locPtr->fire_str() > 0)
+			return (char) FIRE_COLOR;
+
+		if( locPtr->is_plant() )
+			return plant_res.plant_map_color;
+
+		if( !terrain_layer_valid )
+			build_terrain_layer();
+
+		return terrain_layer[yLoc*max_x_loc+xLoc];
+
+	case MAP_MODE_SPOT:
+		if( locPtr->sailable() )
+			return (char) 0x32;
+
+		if( locPtr->has_hill() )
+			return (char) V_BROWN;
+
+		return (char) VGA_GRAY+10;
+
+	case MAP_MODE_POWER:
+		if( locPtr->sailable() )
+			return (char) 0x32;
+
+		if( locPtr->has_hill() )
+			return (char) V_BROWN;
+
+		if( locPtr->is_plant() )
+			return (char) V_DARK_GREEN;
+
+		return nation_array.nation_power_color_array[(unsigned char) locPtr->power_nation_recno];
+	}
+
+	err_here();
+	return UNEXPLORED_COLOR;
+}
+//------- End of function MapMatrix::get_loc_color ---------//
+
+
 //----------- Begin of function MapMatrix::disp ------------//
 //
 // Display the drawn world map on screen, update the location
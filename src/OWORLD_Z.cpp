@@ -47,6 +47,7 @@
 #include <ORAIN.h>
 #include <OSNOW.h>
 #include <OWORLD.h>
+#include <ORENDSNP.h>
 #include <OWEATHER.h>
 #include <OFLAME.h>
 #include <OGODRES.h>
@@ -86,7 +87,7 @@ static int init_fire = -10;						// reset on new game and load game
 
 //-------- Declare static functions ---------//
 
-static int sort_display_function( const void *a, const void *b );
+static bool sort_display_function( const DisplaySort& a, const DisplaySort& b );
 
 
 //------- Define constant for object_type --------//
@@ -114,17 +115,6 @@ enum { LAND_DISP_LAYER_MASK=1,
 		 AIR_DISP_LAYER_MASK=8,
      };
 
-//---------- Define struct DisplaySort ----------//
-
-struct DisplaySort
-{
-	char	object_type;
-	short object_recno;
-	short object_y2;
-	short x_loc, y_loc;
-};
-
-
 //------------ begin of static function draw_unit_path_on_zoom_map -----------//
 // ##### begin Gilbert 9/10 #######//
 static void draw_unit_path_on_zoom_map(int displayLayer)
@@ -314,10 +304,10 @@ static void draw_unit_way_point_on_zoom_map()
 
 //-------- Begin of function ZoomMatrix::ZoomMatrix ----------//
 
-ZoomMatrix::ZoomMatrix() : land_disp_sort_array(sizeof(DisplaySort),100),
-									air_disp_sort_array(sizeof(DisplaySort),50),
-									land_top_disp_sort_array(sizeof(DisplaySort), 40),
-									land_bottom_disp_sort_array(sizeof(DisplaySort), 20)
+ZoomMatrix::ZoomMatrix() : land_disp_sort_array(100),
+									air_disp_sort_array(50),
+									land_top_disp_sort_array(40),
+									land_bottom_disp_sort_array(20)
 {
 	init( ZOOM_X1, ZOOM_Y1, ZOOM_X2, ZOOM_Y2,
 			ZOOM_WIDTH, ZOOM_HEIGHT,
@@ -364,8 +354,6 @@ void ZoomMatrix::draw()
 					power.command_id == COMMAND_BUILD_FIRM ||
 					power.command_id == COMMAND_SETTLE;
 
-	sys.yield();
-
 	//----------------------------------------------------//
 
 	int nationRecno, borderColor;
@@ -486,8 +474,6 @@ void ZoomMatrix::draw()
 		}
 	}
 
-   sys.yield();
-
 	//---------------------------------------------------//
 
 	if( save_image_buf )
@@ -1707,12 +1693,12 @@ void ZoomMatrix::draw_objects()
 	// ###### end Gilbert 2/10 #######//
 
 
-	//---------- quicksort the array -----------//
+	//------- sort the arrays, keeping the order of equal objects -------//
 
-	land_disp_sort_array.quick_sort( sort_display_function );
-	air_disp_sort_array.quick_sort( sort_display_function );
-	land_top_disp_sort_array.quick_sort( sort_display_function );
-	land_bottom_disp_sort_array.quick_sort( sort_display_function );
+	land_disp_sort_array.stable_sort( sort_display_function );
+	air_disp_sort_array.stable_sort( sort_display_function );
+	land_top_disp_sort_array.stable_sort( sort_display_function );
+	land_bottom_disp_sort_array.stable_sort( sort_display_function );
 
 	// ##### begin Gilbert 9/10 ######//
 	//------------ draw unit path and objects ---------------//
@@ -1771,12 +1757,13 @@ void ZoomMatrix::draw_objects()
 
 //---------- Begin of function ZoomMatrix::draw_objects_now -----------//
 //
-void ZoomMatrix::draw_objects_now(DynArray* unitArray, int displayLayer)
+void ZoomMatrix::draw_objects_now(DynArrayT<DisplaySort>* unitArray, int displayLayer)
 {
 	//------------ display objects ------------//
 
 	DisplaySort *displaySortPtr;
 	Firm			*firmPtr;
+	Unit			*unitPtr;
 	int 			i, dispCount = unitArray->size();
 	char			firstFire[FLAME_GROW_STEP];
 	memset( firstFire, 0, sizeof(firstFire));
@@ -1814,19 +1801,22 @@ void ZoomMatrix::draw_objects_now(DynArray* unitArray, int displayLayer)
 
 	for( i=1 ; i<=dispCount ; i++ )
 	{
-		if( i%10==1 )
-			sys.yield();
-
-		displaySortPtr = (DisplaySort*) unitArray->get(i);
+		displaySortPtr = unitArray->get(i);
 
 		switch(displaySortPtr->object_type)
 		{
 			case OBJECT_UNIT:
-				unit_array[displaySortPtr->object_recno]->draw();
+				unitPtr = unit_array[displaySortPtr->object_recno];
+				render_snapshot.shift(unitPtr);
+				unitPtr->draw();
+				render_snapshot.unshift(unitPtr);
 				break;
 
 			case OBJECT_POINTED_UNIT:
-				unit_array[displaySortPtr->object_recno]->draw_outlined();
+				unitPtr = unit_array[displaySortPtr->object_recno];
+				render_snapshot.shift(unitPtr);
+				unitPtr->draw_outlined();
+				render_snapshot.unshift(unitPtr);
 				break;
 
 			case OBJECT_BULLET:
@@ -1971,9 +1961,9 @@ void ZoomMatrix::scroll(int xScroll, int yScroll)
 
 //------ Begin of function sort_display_function ------//
 //
-static int sort_display_function( const void *a, const void *b )
+static bool sort_display_function( const DisplaySort& a, const DisplaySort& b )
 {
-	return ((DisplaySort*)a)->object_y2 - ((DisplaySort*)b)->object_y2;
+	return a.object_y2 < b.object_y2;
 }
 //------- End of function sort_display_function ------//
 
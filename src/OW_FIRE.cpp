@@ -34,7 +34,7 @@
 // #### begin Gilbert 29/5 #######//
 #include <OSERES.h>
 // #### end Gilbert 29/5 #######//
-#include <math.h>
+#include <OFIXED.h>
 //### begin alex 6/8 ###//
 #ifdef DEBUG
 #include <OSYS.h>
@@ -124,8 +124,10 @@ void World::spread_fire(Weather &w)
 	Location *locPtr;
 
 	// -------- normalize wind_speed between -WIND_SPREADFIRE*SPREAD_RATE to +WIND_SPREADFIRE*SPREAD_RATE -------
-	int windCos = int(w.wind_speed() * cos(w.wind_direct_rad()) / 100.0 * SPREAD_RATE * WIND_SPREADFIRE);
-	int windSin = int(w.wind_speed() * sin(w.wind_direct_rad()) / 100.0 * SPREAD_RATE * WIND_SPREADFIRE);
+	int windSpread = w.wind_speed() * SPREAD_RATE * WIND_SPREADFIRE;
+	int windAngle = w.wind_direct() * FIXED_DEGREE;
+	int windCos = fixed_mul(windSpread, fixed_cos(windAngle)) / 100;
+	int windSin = fixed_mul(windSpread, fixed_sin(windAngle)) / 100;
 	char rainSnowReduction = 0;
 	
 	rainSnowReduction = (w.rain_scale() > 0 || w.snow_scale() > 0) ? 
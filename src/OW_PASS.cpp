@@ -0,0 +1,302 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+//Filename    : OW_PASS.CPP
+//Description : Pass maps and connected areas of the world, see OPASSMAP.H
+//              and OREACH.H
+
+#include <string.h>
+#include <ALL.h>
+#include <OWORLD.h>
+#include <OSPATHC.h>
+
+//------- Define constant -------//
+
+#define MAX_REACH_SOURCE_CONN		8		// no. of connected areas around the source checked by can_reach()
+
+static_assert( PASS_LAND == LOCATE_WALK_LAND && PASS_SEA == LOCATE_WALK_SEA,
+	"pass_map bits must be the same as the walkable bits of Location" );
+
+//------- Begin of function PassMap::init -------//
+
+void PassMap::init(int locCount)
+{
+	int bufSize = (locCount+3) >> 2;
+
+	bit_buf = (unsigned char*) mem_resize( bit_buf, bufSize );
+	memset( bit_buf, 0, bufSize );
+
+	loc_count = locCount;
+}
+//-------- End of function PassMap::init --------//
+
+
+//------- Begin of function PassMap::deinit -------//
+
+void PassMap::deinit()
+{
+	if( bit_buf )
+	{
+		mem_del( bit_buf );
+		bit_buf = NULL;
+	}
+
+	loc_count = 0;
+}
+//-------- End of function PassMap::deinit --------//
+
+
+//------- Begin of static function get_pass_bits -------//
+
+static void get_pass_bits(Location* locPtr, int& passBits, int& occupyBits, int& buildBits)
+{
+	passBits = locPtr->loc_flag & (LOCATE_WALK_LAND | LOCATE_WALK_SEA);
+
+	occupyBits = 0;
+
+	if( locPtr->cargo_recno && !(locPtr->loc_flag & LOCATE_BLOCK_MASK) )		// a unit, see Location
+		occupyBits |= OCCUPY_GROUND;
+
+	if( locPtr->air_cargo_recno )
+		occupyBits |= OCCUPY_AIR;
+
+	buildBits = 0;
+
+	if( !locPtr->has_site() )
+		buildBits |= BUILD_NO_SITE;
+
+	if( !locPtr->is_power_off() )
+		buildBits |= BUILD_POWER_ON;
+}
+//-------- End of static function get_pass_bits --------//
+
+
+//--------- Begin of function World::build_pass_maps ----------//
+//
+// Build the pass maps from loc_matrix. After this, the Location
+// functions changing the flags and set_unit_recno() keep them up
+// to date.
+//
+void World::build_pass_maps()
+{
+	int locCount = max_x_loc * max_y_loc;
+
+	pass_map.init(locCount);
+	occupy_map.init(locCount);
+	build_map.init(locCount);
+
+	Location* locPtr = loc_matrix;
+	int passBits, occupyBits, buildBits;
+
+	for( int locOffset=0 ; locOffset<locCount ; locOffset++, locPtr++ )
+	{
+		get_pass_bits(locPtr, passBits, occupyBits, buildBits);
+
+		pass_map.set(locOffset, passBits);
+		occupy_map.set(locOffset, occupyBits);
+		build_map.set(locOffset, buildBits);
+	}
+
+	reach_map.init(&pass_map, max_x_loc, max_y_loc);
+	seek_path_cache.init(max_x_loc, max_y_loc);
+
+	pass_change_count++;
+}
+//----------- End of function World::build_pass_maps ----------//
+
+
+//--------- Begin of function World::update_pass_maps ----------//
+//
+// Called by Location after it changes its flags. Locations outside
+// loc_matrix, and changes made by the map generator before assign_map(),
+// are left to build_pass_maps().
+//
+void World::update_pass_maps(Location* locPtr)
+{
+	if( !loc_matrix || locPtr < loc_matrix )
+		return;
+
+	int locOffset = int(locPtr - loc_matrix);
+
+	if( locOffset >= pass_map.loc_count )
+		return;
+
+	int passBits, occupyBits, buildBits;
+	int oldPassBits = pass_map.get(locOffset);
+	int oldPassType = ReachMap::pass_type( oldPassBits );
+
+	get_pass_bits(locPtr, passBits, occupyBits, buildBits);
+
+	if( passBits != oldPassBits )
+	{
+		pass_change_count++;
+		seek_path_cache.loc_changed(locOffset % max_x_loc, locOffset / max_x_loc);
+	}
+
+	pass_map.set(locOffset, passBits);
+	occupy_map.set(locOffset, occupyBits);
+	build_map.set(locOffset, buildBits);
+
+	//------ update the connected areas -------//
+
+	int newPassType = ReachMap::pass_type( passBits );
+
+	if( newPassType != oldPassType )
+	{
+		if( oldPassType )
+			reach_map.loc_closed(locOffset, oldPassType);
+
+		if( newPassType )
+			reach_map.loc_opened(locOffset);
+	}
+}
+//----------- End of function World::update_pass_maps ----------//
+
+
+//--------- Begin of function World::can_reach ----------//
+//
+// Whether a unit next to or in the source area can reach a location
+// next to or in the destination area, going by the walls, buildings,
+// plants and hills on the map at the moment. Units in the way and the
+// power of nations are not taken into account.
+//
+// <int> srcXLoc1, srcYLoc1,   = the source area
+//       srcXLoc2, srcYLoc2
+// <int> destXLoc1, destYLoc1, = the destination area
+//       destXLoc2, destYLoc2
+// <int> mobileType            = mobile type of the unit
+//
+// return : <int> 1 - it may be reachable, a path must be sought to be sure
+//                0 - it is surely not reachable
+//
+int World::can_reach(int srcXLoc1, int srcYLoc1, int srcXLoc2, int srcYLoc2,
+							int destXLoc1, int destYLoc1, int destXLoc2, int destYLoc2, int mobileType)
+{
+	if( mobileType==UNIT_AIR )
+		return 1;
+
+	int passType = mobileType==UNIT_SEA ? PASS_SEA : PASS_LAND;
+
+	//---- get the connected areas next to and in the source area ----//
+
+	int connArray[MAX_REACH_SOURCE_CONN];
+	int connCount = 0;
+	int xLoc, yLoc, connId, i;
+
+	int xLoc1 = MAX(srcXLoc1-1, 0), xLoc2 = MIN(srcXLoc2+1, max_x_loc-1);
+	int yLoc1 = MAX(srcYLoc1-1, 0), yLoc2 = MIN(srcYLoc2+1, max_y_loc-1);
+
+	for( yLoc=yLoc1 ; yLoc<=yLoc2 ; yLoc++ )
+	{
+		for( xLoc=xLoc1 ; xLoc<=xLoc2 ; xLoc++ )
+		{
+			connId = reach_map.get_conn(xLoc, yLoc, passType);
+
+			if( !connId )
+				continue;
+
+			for( i=0 ; i<connCount && connArray[i]!=connId ; i++ );
+
+			if( i<connCount )
+				continue;
+
+			if( connCount==MAX_REACH_SOURCE_CONN )		// too many to tell
+				return 1;
+
+			connArray[connCount++] = connId;
+		}
+	}
+
+	if( !connCount )		// the unit is not on a passable location, leave it to the path seeking
+		return 1;
+
+	//---- check the locations next to and in the destination area ----//
+
+	xLoc1 = MAX(destXLoc1-1, 0), xLoc2 = MIN(destXLoc2+1, max_x_loc-1);
+	yLoc1 = MAX(destYLoc1-1, 0), yLoc2 = MIN(destYLoc2+1, max_y_loc-1);
+
+	for( yLoc=yLoc1 ; yLoc<=yLoc2 ; yLoc++ )
+	{
+		for( xLoc=xLoc1 ; xLoc<=xLoc2 ; xLoc++ )
+		{
+			connId = reach_map.get_conn(xLoc, yLoc, passType);
+
+			if( !connId )
+				continue;
+
+			for( i=0 ; i<connCount ; i++ )
+			{
+				if( connArray[i]==connId )
+					return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+//----------- End of function World::can_reach ----------//
+
+
+//--------- Begin of function World::locate_reachable ----------//
+//
+// Locate the location closest to the given one that a land unit at
+// the source location can reach.
+//
+// <int&> xLoc, yLoc         = the location to start from, also for returning the result
+// <int>  srcXLoc, srcYLoc   = location of the unit
+// <int>  maxRange           = the farthest distance to look
+//
+// return : <int> 1 - a location is found
+//                0 - not found
+//
+int World::locate_reachable(int& xLoc, int& yLoc, int srcXLoc, int srcYLoc, int maxRange)
+{
+	int srcConnId = reach_map.get_conn(srcXLoc, srcYLoc, PASS_LAND);
+
+	if( !srcConnId )
+		return 0;
+
+	for( int range=1 ; range<=maxRange ; range++ )
+	{
+		int xLoc1 = xLoc-range, xLoc2 = xLoc+range;
+		int yLoc1 = yLoc-range, yLoc2 = yLoc+range;
+
+		for( int y=MAX(yLoc1, 0) ; y<=MIN(yLoc2, max_y_loc-1) ; y++ )
+		{
+			int xStep = (y==yLoc1 || y==yLoc2) ? 1 : xLoc2-xLoc1;		// the whole top and bottom rows, only the two ends of the others
+
+			for( int x=xLoc1 ; x<=xLoc2 ; x+=xStep )
+			{
+				if( x<0 || x>=max_x_loc )
+					continue;
+
+				if( reach_map.get_conn(x, y, PASS_LAND)==srcConnId )
+				{
+					xLoc = x;
+					yLoc = y;
+					return 1;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+//----------- End of function World::locate_reachable ----------//
@@ -0,0 +1,271 @@
+/*
+ * Seven Kingdoms: Ambition
+ *
+ * Copyright 2026 Tim Sviridov
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+//Filename    : ReplayCheck.cpp
+//Description : Checking the simulation results and speed of a replay
+
+#include <stdio.h>
+#include <string.h>
+
+#include <ReplayCheck.h>
+#include <OCRC_STO.h>
+
+static const char golden_magic[] = "7KRC";
+static const int golden_version = 1;
+
+static const char *step_name_array[ReplayCheck::STEP_COUNT] =
+{
+	"unit_array",
+	"firm_array",
+	"town_array",
+	"nation_array",
+	"bullet_array",
+	"world",
+	"other",
+};
+
+static const char *result_name_array[] =
+{
+	"pass",
+	"mismatch",
+	"slow",
+	"error",
+};
+
+ReplayCheck::ReplayCheck()
+{
+	active = 0;
+	crc_path = NULL;
+	report_path = NULL;
+	max_slowdown = -1;
+	has_golden = 0;
+	golden_time_ms = 0;
+	mismatch_frame = -1;
+	frame_count = 0;
+	memset(step_ms_array, 0, sizeof(step_ms_array));
+}
+
+ReplayCheck::~ReplayCheck()
+{
+}
+
+// crcPath     - the checksum file, written if it does not exist yet,
+//               may be NULL
+// reportPath  - the JSON report to write, may be NULL
+// maxSlowdown - fail if the replay takes this many percent longer than
+//               the time in the checksum file, -1 not to check the time
+void ReplayCheck::init(const char *crcPath, const char *reportPath, int maxSlowdown)
+{
+	active = 1;
+	crc_path = crcPath;
+	report_path = reportPath;
+	max_slowdown = maxSlowdown;
+
+	has_golden = crc_path ? read_golden() : 0;
+
+	frame_array.clear();
+	crc_array.clear();
+	mismatch_frame = -1;
+	frame_count = 0;
+	memset(step_ms_array, 0, sizeof(step_ms_array));
+}
+
+// Called after the replay has been played. Returns one of RESULT_*.
+int ReplayCheck::finish(const char *replayPath, int replayLoaded)
+{
+	if( !active )
+		return RESULT_PASS;
+
+	active = 0;
+
+	long timeMs = 0;
+	if( frame_count )
+		timeMs = (long)std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start_time).count();
+
+	int result = RESULT_PASS;
+
+	if( !replayLoaded || !frame_count || has_golden < 0 )
+	{
+		result = RESULT_ERROR;
+	}
+	else if( has_golden > 0 )
+	{
+		// a replay ended early or late has a mismatch at the first missing checksum
+		if( mismatch_frame < 0 && crc_array.size() != golden_crc_array.size() )
+		{
+			if( crc_array.size() < golden_crc_array.size() )
+				mismatch_frame = golden_frame_array[crc_array.size()];
+			else
+				mismatch_frame = frame_array[golden_crc_array.size()];
+		}
+
+		if( mismatch_frame >= 0 )
+			result = RESULT_MISMATCH;
+		else if( max_slowdown >= 0 && golden_time_ms > 0 &&
+			timeMs * 100 > golden_time_ms * (100 + max_slowdown) )
+			result = RESULT_SLOW;
+	}
+	else if( crc_path )
+	{
+		write_golden(timeMs);
+	}
+
+	if( report_path )
+		write_report(replayPath, result, timeMs);
+
+	printf("%s: %s, %ld frames in %ld ms", replayPath, result_name_array[result], frame_count, timeMs);
+	if( mismatch_frame >= 0 )
+		printf(", first mismatch at frame %ld", mismatch_frame);
+	printf("\n");
+
+	return result;
+}
+
+// Called by Sys::run() after CrcStore::record_all(). The object
+// checksums of the frame are folded into one value.
+void ReplayCheck::add_crc(uint32_t frameNo)
+{
+	if( !active )
+		return;
+
+	uint32_t crc = 2166136261u;
+	for( int i = 0; i < crc_store.all_crc.length(); i++ )
+		crc = (crc ^ (unsigned char)crc_store.all_crc.queue_buf[i]) * 16777619u;
+
+	size_t index = crc_array.size();
+	frame_array.push_back(frameNo);
+	crc_array.push_back(crc);
+
+	if( has_golden > 0 && mismatch_frame < 0 )
+	{
+		if( index >= golden_crc_array.size() ||
+			golden_frame_array[index] != frameNo ||
+			golden_crc_array[index] != crc )
+			mismatch_frame = frameNo;
+	}
+}
+
+void ReplayCheck::begin_frame_time()
+{
+	step_time = Clock::now();
+
+	if( !frame_count )
+		start_time = step_time;	// the time loading the game is not counted
+
+	frame_count++;
+}
+
+void ReplayCheck::add_step_time(int stepId)
+{
+	Clock::time_point curTime = Clock::now();
+
+	step_ms_array[stepId] += std::chrono::duration<double, std::milli>(curTime - step_time).count();
+	step_time = curTime;
+}
+
+// Format of the checksum file:
+//
+// 7KRC <version>
+// time_ms <time taken>
+// <frame> <checksum in hex>
+// ...
+//
+// Returns 1 if it is read, 0 if it does not exist, -1 if it is not a
+// checksum file.
+int ReplayCheck::read_golden()
+{
+	FILE *file = fopen(crc_path, "r");
+	if( !file )
+		return 0;
+
+	golden_frame_array.clear();
+	golden_crc_array.clear();
+
+	char magic[5];
+	int version;
+	uint32_t frameNo, crc;
+	int rc = -1;
+
+	if( fscanf(file, "%4s %d", magic, &version) == 2 &&
+		!strcmp(magic, golden_magic) && version == golden_version &&
+		fscanf(file, " time_ms %ld", &golden_time_ms) == 1 )
+	{
+		while( fscanf(file, "%u %x", &frameNo, &crc) == 2 )
+		{
+			golden_frame_array.push_back(frameNo);
+			golden_crc_array.push_back(crc);
+		}
+		rc = 1;
+	}
+
+	fclose(file);
+	return rc;
+}
+
+void ReplayCheck::write_golden(long timeMs)
+{
+	FILE *file = fopen(crc_path, "w");
+	if( !file )
+		return;
+
+	fprintf(file, "%s %d\n", golden_magic, golden_version);
+	fprintf(file, "time_ms %ld\n", timeMs);
+	for( size_t i = 0; i < crc_array.size(); i++ )
+		fprintf(file, "%u %08x\n", frame_array[i], crc_array[i]);
+
+	fclose(file);
+}
+
+static void write_json_str(FILE *file, const char *str)
+{
+	fputc('"', file);
+	for( ; *str; str++ )
+	{
+		if( *str == '"' || *str == '\\' )
+			fputc('\\', file);
+		fputc(*str, file);
+	}
+	fputc('"', file);
+}
+
+void ReplayCheck::write_report(const char *replayPath, int result, long timeMs)
+{
+	FILE *file = fopen(report_path, "w");
+	if( !file )
+		return;
+
+	fprintf(file, "{\n  \"replay\": ");
+	write_json_str(file, replayPath);
+	fprintf(file, ",\n  \"result\": \"%s\",\n", result_name_array[result]);
+	fprintf(file, "  \"frames\": %ld,\n", frame_count);
+	fprintf(file, "  \"time_ms\": %ld,\n", timeMs);
+	fprintf(file, "  \"fps\": %.1f,\n", timeMs ? frame_count * 1000.0 / timeMs : 0.0);
+	fprintf(file, "  \"crc_count\": %d,\n", (int)crc_array.size());
+	fprintf(file, "  \"golden_crc_count\": %d,\n", has_golden > 0 ? (int)golden_crc_array.size() : -1);
+	fprintf(file, "  \"golden_time_ms\": %ld,\n", has_golden > 0 ? golden_time_ms : -1L);
+	fprintf(file, "  \"first_mismatch_frame\": %ld,\n", mismatch_frame);
+	fprintf(file, "  \"step_ms\": {\n");
+	for( int i = 0; i < STEP_COUNT; i++ )
+		fprintf(file, "    \"%s\": %.1f%s\n", step_name_array[i], step_ms_array[i], i < STEP_COUNT-1 ? "," : "");
+	fprintf(file, "  }\n}\n");
+
+	fclose(file);
+}
@@ -34,6 +34,7 @@
 #include "Ambition_config.hh"
 #include "Ambition_control.hh"
 #include "Ambition_news.hh"
+#include "Ambition_repository.hh"
 #include "Ambition_version.hh"
 #include "Ambition_vga.hh"
 #include "format.hh"
@@ -80,6 +81,11 @@ void displayNews(
   }
 }
 
+unsigned long long int entityCount(
+) {
+  return Ambition::entityRepository.recordCount();
+}
+
 void pasteFromClipboard(
   char* destination,
   const unsigned int maximumSize
@@ -45,6 +45,17 @@ void loadGame(
   Ambition::read(filename, startingPosition);
 }
 
+void loadGame(
+  std::istream& saveFile
+) {
+  if (!Ambition::config.enhancementsAvailable()) {
+    return;
+  }
+
+  Ambition::entityRepository.reset();
+  Ambition::read(saveFile);
+}
+
 void saveGame(
   const std::string filename
 ) {
@@ -55,4 +66,14 @@ void saveGame(
   Ambition::write(filename);
 }
 
+void saveGame(
+  std::ostream& saveFile
+) {
+  if (!Ambition::config.enhancementsAvailable()) {
+    return;
+  }
+
+  Ambition::write(saveFile);
+}
+
 } // namespace _7kaaAmbitionInterface::Serialisation
@@ -38,6 +38,11 @@ namespace Ambition {
 
 Repository entityRepository;
 
+std::size_t Repository::recordCount(
+) const {
+  return records.size();
+}
+
 void Repository::reset(
 ) {
   records.clear();
@@ -62,6 +62,12 @@ void read(
 
   saveFile.seekg(startingPosition);
 
+  read(saveFile);
+}
+
+void read(
+  std::istream& saveFile
+) {
   std::string rollingBuffer;
   auto bookmarkPosition = std::string::npos;
 
@@ -144,12 +150,18 @@ void read(
 void write(
   const std::string filename
 ) {
-  uint64_t flags = 0;
-  flags |= HeaderFlags::BoostXml;
-
   std::ofstream saveFile(filename, std::ios::app);
   assert(saveFile.good());
 
+  write(saveFile);
+}
+
+void write(
+  std::ostream& saveFile
+) {
+  uint64_t flags = 0;
+  flags |= HeaderFlags::BoostXml;
+
   saveFile << BOOKMARK << std::endl;
   saveFile << HEADER_START << std::endl;
   saveFile << flags << std::endl;
@@ -26,6 +26,8 @@ FileReader::FileReader()
 {
    this->file = NULL;
    this->ok = true;
+   this->buffer_len = 0;
+   this->buffer_pos = 0;
 }
 
 FileReader::~FileReader()
@@ -42,6 +44,8 @@ bool FileReader::init(File *file)
 
    this->file = file;
    this->ok = true;
+   this->buffer_len = 0;
+   this->buffer_pos = 0;
    this->original_type = this->file->file_type;
 
    /* We need raw file access */
@@ -56,6 +60,8 @@ void FileReader::deinit()
    if (this->file == NULL)
       return;
 
+   this->drop_buffer();
+
    this->file->file_type = this->original_type;
    this->is.close();
    this->file = NULL;
@@ -66,11 +72,75 @@ bool FileReader::good() const
    return this->ok;
 }
 
+/*
+ * Reads the next len bytes into the buffer, normally the size of the
+ * record about to be read.
+ */
+bool FileReader::prefetch(size_t len)
+{
+   if (!this->drop_buffer())
+      return false;
+
+   if (len > BUFFER_SIZE)
+      len = BUFFER_SIZE;
+
+   if (this->is.read(this->buffer, len) != long(len))
+   {
+      this->ok = false;
+      return false;
+   }
+
+   this->buffer_len = len;
+
+   return true;
+}
+
+/* Gives the bytes prefetched but not used back to the file */
+bool FileReader::drop_buffer()
+{
+   size_t left = this->buffer_len - this->buffer_pos;
+
+   this->buffer_len = 0;
+   this->buffer_pos = 0;
+
+   if (left > 0 && this->ok && !this->is.seek(-long(left), SEEK_CUR))
+      this->ok = false;
+
+   return this->ok;
+}
+
+bool FileReader::read_bytes(void *data, size_t len)
+{
+   if (!this->ok)
+      return false;
+
+   if (this->buffer_pos + len <= this->buffer_len)
+   {
+      memcpy(data, this->buffer + this->buffer_pos, len);
+      this->buffer_pos += len;
+      return true;
+   }
+
+   if (this->drop_buffer() && this->is.read(data, len) != long(len))
+      this->ok = false;
+
+   return this->ok;
+}
+
 bool FileReader::skip(size_t len)
 {
    if (!this->ok)
       return false;
 
+   if (this->buffer_pos + len <= this->buffer_len)
+   {
+      this->buffer_pos += len;
+      return true;
+   }
+
+   if (!this->drop_buffer())
+      return false;
+
    if (!this->is.seek(len, SEEK_CUR))
       this->ok = false;
 
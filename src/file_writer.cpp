@@ -23,6 +23,7 @@ FileWriter::FileWriter()
 {
    this->file = NULL;
    this->ok = true;
+   this->buffer_len = 0;
 }
 
 FileWriter::~FileWriter()
@@ -39,6 +40,7 @@ bool FileWriter::init(File *file)
 
    this->file = file;
    this->ok = true;
+   this->buffer_len = 0;
    this->original_type = this->file->file_type;
 
    /* We need raw file access */
@@ -53,6 +55,8 @@ void FileWriter::deinit()
    if (this->file == NULL)
       return;
 
+   this->flush();
+
    this->file->file_type = this->original_type;
    this->os.close();
    this->file = NULL;
@@ -63,6 +67,42 @@ bool FileWriter::good() const
    return this->ok;
 }
 
+/* Writes the buffered values to the file. Returns good(). */
+bool FileWriter::flush()
+{
+   if (this->buffer_len > 0 && this->ok)
+   {
+      if (this->os.write(this->buffer, this->buffer_len) != long(this->buffer_len))
+	 this->ok = false;
+   }
+
+   this->buffer_len = 0;
+
+   return this->ok;
+}
+
+bool FileWriter::write_bytes(const void *data, size_t len)
+{
+   if (!this->ok)
+      return false;
+
+   if (this->buffer_len + len > BUFFER_SIZE && !this->flush())
+      return false;
+
+   if (len > BUFFER_SIZE)
+   {
+      if (this->os.write(data, len) != long(len))
+	 this->ok = false;
+
+      return this->ok;
+   }
+
+   memcpy(this->buffer + this->buffer_len, data, len);
+   this->buffer_len += len;
+
+   return true;
+}
+
 bool FileWriter::skip(size_t len)
 {
    const char *chars = "\xc0\xde\xba\xbe";
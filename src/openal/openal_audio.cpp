@@ -21,6 +21,7 @@
  */
 #include <assert.h>
 #include <math.h>
+#include <chrono>
 #include <vector>
 #include <cstdlib>
 
@@ -46,6 +47,8 @@
 
 DBGLOG_DEFAULT_CHANNEL(Audio);
 
+typedef std::lock_guard<std::recursive_mutex> StreamLockGuard;
+
 static bool check_al(int line)
 {
 	ALenum err = alGetError();
@@ -163,6 +166,7 @@ OpenALAudio::OpenALAudio()
 {
 	this->al_context = NULL;
 	this->al_device  = NULL;
+	this->stream_thread_quit = false;
 }
 
 OpenALAudio::~OpenALAudio()
@@ -278,6 +282,10 @@ int OpenALAudio::init_wav()
 	normal_sources = 0; long_sources = 0; loop_sources = 0;
 
 	this->wav_init_flag = true;
+
+	this->stream_thread_quit = false;
+	this->stream_thread = std::thread(&OpenALAudio::stream_thread_main, this);
+
 	return 1;
 
 err:
@@ -287,6 +295,12 @@ err:
 
 void OpenALAudio::deinit_wav()
 {
+	if (this->stream_thread.joinable())
+	{
+		this->stream_thread_quit = true;
+		this->stream_thread.join();
+	}
+
 	this->wav_init_flag = false;
 
 	this->stop_wav();
@@ -363,6 +377,8 @@ int OpenALAudio::play_wav(char *file_name, const DsVolume &vol)
 {
 	int idx;
 
+	StreamLockGuard lock(this->stream_lock);
+
 	if (!this->wav_init_flag || !this->wav_flag)
 		return 0;
 
@@ -395,6 +411,8 @@ int OpenALAudio::play_wav(short index, const DsVolume &vol)
 	char *data;
 	MemInputStream *in;
 
+	StreamLockGuard lock(this->stream_lock);
+
 	if (!this->wav_init_flag || !this->wav_flag)
 		return 0;
 
@@ -438,6 +456,8 @@ int OpenALAudio::play_resided_wav(char *buf, const DsVolume &vol)
 	uint32_t size;
 	MemInputStream *in;
 
+	StreamLockGuard lock(this->stream_lock);
+
 	if (!this->wav_init_flag || !this->wav_flag)
 		return 0;
 
@@ -462,6 +482,8 @@ int OpenALAudio::get_free_wav_ch()
 {
 	int free_count;
 
+	StreamLockGuard lock(this->stream_lock);
+
 	if (!this->wav_init_flag)
 		return 0;
 
@@ -503,10 +525,12 @@ int OpenALAudio::play_long_wav(const char *file_name, const DsVolume &vol)
 //
 // return: 1 - wav loaded and is playing
 //         0 - wav not played
-// OpenALAudio::yield() keeps on feeding data to it
+// stream_thread keeps on feeding data to it
 //
 int OpenALAudio::play_any_wav(WaveType waveType, const char *file_name, const DsVolume &vol)
 {
+	StreamLockGuard lock(this->stream_lock);
+
 	if (!this->wav_init_flag)
 		return 0;
 
@@ -560,6 +584,8 @@ int OpenALAudio::play_any_wav(WaveType waveType, InputStream *in, const DsVolume
 	WavStream *ws = NULL;
 	int id;
 
+	StreamLockGuard lock(this->stream_lock);
+
 	assert(this->wav_init_flag);
 
 	// Limit amount of sources
@@ -639,6 +665,8 @@ int OpenALAudio::stop_any_wav(int id)
 	StreamMap::iterator itr;
 	StreamContext *sc;
 
+	StreamLockGuard lock(this->stream_lock);
+
 	if (!this->wav_init_flag)
 		return 1;
 
@@ -674,6 +702,8 @@ int OpenALAudio::stop_any_wav(int id)
 //
 int OpenALAudio::is_long_wav_playing(int id)
 {
+	StreamLockGuard lock(this->stream_lock);
+
 	return (this->streams.find(id) != this->streams.end());
 }
 
@@ -691,6 +721,8 @@ int OpenALAudio::play_loop_wav(const char *file_name, int repeat_offset, const D
 	int id;
 	StreamContext *sc;
 
+	StreamLockGuard lock(this->stream_lock);
+
 	if (!this->wav_init_flag || !this->wav_flag)
 		return 0;
 
@@ -722,6 +754,8 @@ void OpenALAudio::fade_out_loop_wav(int id, int fade_duration_msec)
 	StreamMap::const_iterator itr;
 	StreamContext *sc;
 
+	StreamLockGuard lock(this->stream_lock);
+
 	if (!this->wav_init_flag)
 		return;
 
@@ -743,6 +777,8 @@ DsVolume OpenALAudio::get_loop_wav_volume(int id)
 	float position[3];
 	float gain;
 
+	StreamLockGuard lock(this->stream_lock);
+
 	if (!this->wav_init_flag)
 		return DsVolume(0, 0);
 
@@ -766,6 +802,8 @@ int OpenALAudio::is_loop_wav_fading(int id)
 {
 	StreamMap::const_iterator itr;
 
+	StreamLockGuard lock(this->stream_lock);
+
 	if (!this->wav_init_flag)
 		return false;
 
@@ -776,7 +814,39 @@ int OpenALAudio::is_loop_wav_fading(int id)
 	return (itr->second->fade_frames != 0);
 }
 
+// Refills the buffers of streams started by play_any_wav and drops the
+// streams which have finished. Is done by stream_thread, only if the
+// thread could not be started it is done here.
+//
 void OpenALAudio::yield()
+{
+	if (this->stream_thread.joinable())
+		return;
+
+	StreamLockGuard lock(this->stream_lock);
+
+	this->stream_all();
+}
+
+// Body of stream_thread, runs from init_wav until deinit_wav
+//
+void OpenALAudio::stream_thread_main()
+{
+	while (!this->stream_thread_quit)
+	{
+		{
+			StreamLockGuard lock(this->stream_lock);
+
+			this->stream_all();
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(STREAM_INTERVAL_MSEC));
+	}
+}
+
+// Caller must hold stream_lock
+//
+void OpenALAudio::stream_all()
 {
 	StreamMap::iterator si;
 
@@ -821,6 +891,8 @@ void OpenALAudio::stop_wav()
 {
 	StreamMap::const_iterator itr;
 
+	StreamLockGuard lock(this->stream_lock);
+
 	for (itr = this->streams.begin(); itr != this->streams.end(); ++itr)
 		delete itr->second;
 
@@ -858,6 +930,8 @@ int OpenALAudio::is_mid_playing()
 
 int OpenALAudio::is_wav_playing()
 {
+	StreamLockGuard lock(this->stream_lock);
+
 	if (!this->wav_init_flag)
 		return false;
 
@@ -908,6 +982,8 @@ void OpenALAudio::set_wav_volume(int vol)
 	float gain_mult;
 	int diff;
 
+	StreamLockGuard lock(this->stream_lock);
+
 	if (!this->wav_init_flag)
 		return;
 
@@ -952,6 +1028,8 @@ void OpenALAudio::volume_long_wav(int id, const DsVolume &vol)
 	StreamContext *sc;
 	StreamMap::const_iterator itr;
 
+	StreamLockGuard lock(this->stream_lock);
+
 	if (!this->wav_init_flag)
 		return;
 
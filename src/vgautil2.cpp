@@ -25,6 +25,7 @@
 #include <OMOUSE.h>
 #include <OMOUSECR.h>
 #include <OVGA.h>
+#include <OINFOFLD.h>
 #include <vga_util.h>
 
 //-------- Define constant --------//
@@ -67,6 +68,8 @@ void VgaUtil::blt_buf(int x1, int y1, int x2, int y2, int putBackCursor)
    IMGcopy( vga_front.buf_ptr(), vga_front.buf_pitch(),
       vga_back.buf_ptr(), vga_back.buf_pitch(), x1, y1, x2, y2 );
 
+   info_field_cache.clear_area(x1, y1, x2, y2);    // the fields there are no longer on the screen
+
    //--------------------------------------//
 
    if( putBackCursor )